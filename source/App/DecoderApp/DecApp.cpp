@@ -44,6 +44,7 @@
 #include "DecApp.h"
 #include "DecoderLib/AnnexBread.h"
 #include "DecoderLib/NALread.h"
+#include "Utilities/StreamIO.h"
 #if RExt__DECODER_DEBUG_STATISTICS
 #include "CommonLib/CodingStatistics.h"
 #endif
@@ -93,7 +94,8 @@ uint32_t DecApp::decode()
   bitstreamSize.close();
 #endif
 
-  std::ifstream bitstreamFile(m_bitstreamFileName.c_str(), std::ifstream::in | std::ifstream::binary);
+  std::ifstream bitstreamFile(getStreamFileName(m_bitstreamFileName, false).c_str(),
+                              std::ifstream::in | std::ifstream::binary);
   if (!bitstreamFile)
   {
     EXIT( "Failed to open bitstream file " << m_bitstreamFileName.c_str() << " for reading" ) ;
@@ -448,8 +450,8 @@ uint32_t DecApp::decode()
           const auto  vps           = m_cDecLib.getVPS();
           std::string reconFileName = m_reconFileName;
 
-          if (m_reconFileName.compare("/dev/null") && vps != nullptr && vps->getMaxLayers() > 1
-              && xIsNaluWithinTargetOutputLayerIdSet(&nalu))
+          if (m_reconFileName.compare("/dev/null") && !isStdStreamFileName(m_reconFileName) && vps != nullptr
+              && vps->getMaxLayers() > 1 && xIsNaluWithinTargetOutputLayerIdSet(&nalu))
           {
             const size_t      pos         = reconFileName.find_last_of('.');
             const std::string layerString = std::string(".layer") + std::to_string(nalu.m_nuhLayerId);
@@ -944,6 +946,9 @@ void DecApp::xCreateDecLib()
   }
 #endif
   m_cDecLib.m_targetSubPicIdx = this->m_targetSubPicIdx;
+  m_cDecLib.setNumThreads(m_numThreads);
+  m_cDecLib.setFrameParallelDecoding(m_frameParallel);
+  m_cDecLib.setDecoupledParsing(m_decoupledParsing);
   m_cDecLib.initScalingList();
 #if GDR_LEAK_TEST
   m_cDecLib.m_gdrPocRandomAccess = this->m_gdrPocRandomAccess;
@@ -988,6 +993,10 @@ void DecApp::xWriteOutput( PicList* pcListPic, uint32_t tId )
   {
     return;
   }
+  if (getShutterFilterFlag())
+  {
+    m_cDecLib.waitForLoopFilterJob();   // the shutter interval filter blends neighbouring pictures
+  }
 
   PicList::iterator iterPic   = pcListPic->begin();
   int numPicsNotYetDisplayed = 0;
@@ -1066,6 +1075,10 @@ void DecApp::xWriteOutput( PicList* pcListPic, uint32_t tId )
           (numPicsNotYetDisplayed >  maxNumReorderPicsHighestTid || dpbFullness > maxDecPicBufferingHighestTid) &&
           pcPicBottom->getPOC() >= m_iPOCLastDisplay )
       {
+        if (!pcPicTop->isDecodingFinished() || !pcPicBottom->isDecodingFinished())
+        {
+          break;   // still loop filtered in the background, output with the next picture
+        }
         // write to file
         numPicsNotYetDisplayed = numPicsNotYetDisplayed-2;
         if ( !m_reconFileName.empty() )
@@ -1118,6 +1131,10 @@ void DecApp::xWriteOutput( PicList* pcListPic, uint32_t tId )
       if(pcPic->neededForOutput && pcPic->getPOC() >= m_iPOCLastDisplay &&
         (numPicsNotYetDisplayed >  maxNumReorderPicsHighestTid || dpbFullness > maxDecPicBufferingHighestTid))
       {
+        if (!pcPic->isDecodingFinished())
+        {
+          break;   // still loop filtered in the background, output with the next picture
+        }
         // write to file
         numPicsNotYetDisplayed--;
         if (!pcPic->referenced)
@@ -1248,6 +1265,7 @@ void DecApp::xFlushOutput( PicList* pcListPic, const int layerId )
   {
     return;
   }
+  m_cDecLib.waitForLoopFilterJob();
   PicList::iterator iterPic   = pcListPic->begin();
 
   iterPic   = pcListPic->begin();
@@ -75,8 +75,8 @@ bool DecAppCfg::parseCfg( int argc, char* argv[] )
   // clang-format off
   opts.addOptions()
   ("help",                      do_help,                               false,      "this help text")
-  ("BitstreamFile,b",           m_bitstreamFileName,                   std::string(""), "bitstream input file name")
-  ("ReconFile,o",               m_reconFileName,                       std::string(""), "reconstructed YUV output file name\n")
+  ("BitstreamFile,b",           m_bitstreamFileName,                   std::string(""), "bitstream input file name (-: standard input)")
+  ("ReconFile,o",               m_reconFileName,                       std::string(""), "reconstructed YUV output file name (-: standard output)\n")
   ("OplFile,-opl",              m_oplFilename,                         std::string(""), "opl-file name without extension for conformance testing\n")
 
 #if ENABLE_SIMD_OPT
@@ -128,6 +128,9 @@ bool DecAppCfg::parseCfg( int argc, char* argv[] )
 #endif
   ("MCTSCheck",                m_mctsCheck,                            false,      "If enabled, the decoder checks for violations of mc_exact_sample_value_match_flag in Temporal MCTS ")
   ("targetSubPicIdx",          m_targetSubPicIdx,                      0,          "Specify which subpicture shall be written to output, using subpic index, 0: disabled, subpicIdx=m_targetSubPicIdx-1 \n" )
+  ("Threads",                  m_numThreads,                           0,          "Number of worker threads reconstructing CTU lines of wavefront, tile, subpicture and multi-slice bitstreams in parallel to parsing (0 or 1: single-threaded)")
+  ("FrameParallel",            m_frameParallel,                        false,      "Loop filter each picture on a worker thread while the next picture is decoded (requires Threads > 1)")
+  ("DecoupledParsing",         m_decoupledParsing,                     false,      "Also reconstruct the CTUs of bitstreams without wavefronts, tiles, subpictures or multiple slices on worker threads while the slice is parsed (requires Threads > 1)")
   ("UpscaledOutput",           m_upscaledOutput,                       0,          "Output upscaled (2), decoded but in full resolution buffer (1) or decoded cropped (0, default) picture for RPR" )
   ("UpscaledOutputWidth",      m_upscaledOutputWidth,                  0,          "Forced upscaled output width (override SPS)" )
   ("UpscaledOutputHeight",     m_upscaledOutputHeight,                 0,          "Forced upscaled output height (override SPS)" )
@@ -285,6 +288,9 @@ DecAppCfg::DecAppCfg()
   , m_packedYUVMode(false)
   , m_statMode(0)
   , m_mctsCheck(false)
+  , m_numThreads(0)
+  , m_frameParallel(false)
+  , m_decoupledParsing(false)
 {
   m_outputBitDepth.fill(0);
 }
@@ -102,6 +102,9 @@ protected:
   int           m_upscaledOutputHeight;
   int           m_upscaleFilterForDisplay;
   int           m_targetSubPicIdx;                    ///< Specify which subpicture shall be write to output, using subpicture index
+  int           m_numThreads;                         ///< number of worker threads for parallel decoding (0 or 1: single-threaded)
+  bool          m_frameParallel;                      ///< overlap the loop filtering of a picture with decoding the next one
+  bool          m_decoupledParsing;                   ///< parse and reconstruct on different threads for any bitstream
 #if JVET_AJ0151_DSC_SEI
   std::string   m_keyStoreDir;
   std::string   m_trustStoreDir;
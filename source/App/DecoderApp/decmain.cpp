@@ -40,6 +40,7 @@
 #include <time.h>
 #include "DecApp.h"
 #include "program_options_lite.h"
+#include "StreamIO.h"
 
 //! \ingroup DecoderApp
 //! \{
@@ -52,6 +53,19 @@ int main(int argc, char* argv[])
 {
   int returnCode = EXIT_SUCCESS;
 
+  // an output to the standard output leaves it to the data, the messages go to the standard error
+  {
+    std::string reconFileName;
+    ProgramOptionsLite::Options optsOutput;
+    optsOutput.addOptions()("ReconFile,o", reconFileName, std::string(""), "");
+    ProgramOptionsLite::SilentReporter errOutput;
+    ProgramOptionsLite::scanArgv(optsOutput, argc, (const char**) argv, errOutput);
+    if (isStdStreamFileName(reconFileName))
+    {
+      redirectMessagesToStdErr();
+    }
+  }
+
   // print information
   fprintf( stdout, "\n" );
   fprintf( stdout, "VVCSoftware: VTM Decoder Version %s ", VTM_VERSION );
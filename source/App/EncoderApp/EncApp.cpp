@@ -45,6 +45,7 @@
 #include "EncApp.h"
 #include "EncoderLib/AnnexBwrite.h"
 #include "EncoderLib/EncLibCommon.h"
+#include "Utilities/StreamIO.h"
 
 //! \ingroup EncoderApp
 //! \{
@@ -63,6 +64,7 @@ EncApp::EncApp(std::fstream &bitStream, EncLibCommon *encLibCommon) : m_cEncLib(
 #endif
   m_numEncoded = 0;
   m_flush = false;
+  m_stopInput = false;
 }
 
 EncApp::~EncApp()
@@ -1393,6 +1395,7 @@ void EncApp::xInitLibCfg( int layerIdx )
 #endif 
   m_cEncLib.setEntropyCodingSyncEnabledFlag                      ( m_entropyCodingSyncEnabledFlag );
   m_cEncLib.setEntryPointPresentFlag                             ( m_entryPointPresentFlag );
+  m_cEncLib.setNumThreads                                        ( m_numThreads );
   m_cEncLib.setTMVPModeId                                        ( m_TMVPModeId );
   m_cEncLib.setSliceLevelRpl                                     ( m_sliceLevelRpl  );
   m_cEncLib.setSliceLevelDblk                                    ( m_sliceLevelDblk );
@@ -1688,7 +1691,7 @@ void EncApp::xCreateLib( std::list<PelUnitBuf*>& recBufList, const int layerId )
     }
 
     std::string reconFileName = m_reconFileName;
-    if( m_reconFileName.compare( "/dev/null" ) &&  (m_maxLayers > 1) )
+    if( m_reconFileName.compare( "/dev/null" ) && !isStdStreamFileName( m_reconFileName ) && (m_maxLayers > 1) )
     {
       size_t pos = reconFileName.find_last_of('.');
       if (pos != std::string::npos)
@@ -1782,7 +1785,7 @@ void EncApp::createLib( const int layerIdx )
 
   if( !m_bitstream.is_open() )
   {
-    m_bitstream.open(m_bitstreamFileName.c_str(), std::fstream::binary | std::fstream::out);
+    m_bitstream.open(getStreamFileName(m_bitstreamFileName, true).c_str(), std::fstream::binary | std::fstream::out);
     if( !m_bitstream )
     {
       EXIT( "Failed to open bitstream file " << m_bitstreamFileName.c_str() << " for writing\n" );
@@ -1828,10 +1831,14 @@ void EncApp::createLib( const int layerIdx )
                                m_fgcSEITemporalFilterPastRefs, m_fgcSEITemporalFilterFutureRefs, m_firstValidFrame,
                                m_lastValidFrame, true, m_cEncLib.getAdaptQPmap(), m_cEncLib.getBIM(), m_ctuSize);
   }
+
+  xStartInputThread();
 }
 
 void EncApp::destroyLib()
 {
+  xStopInputThread();
+
   printf( "\nLayerId %2d", m_cEncLib.getLayerId() );
 
   m_cEncLib.printSummary( m_isField );
@@ -1896,44 +1903,53 @@ bool EncApp::encodePrep( bool& eos )
   const InputColourSpaceConversion snrCSC = ( !m_snrInternalColourSpace ) ? m_inputColourSpaceConvert : IPCOLOURSPACE_UNCHANGED;
 
   // read input YUV file
-#if EXTENSION_360_VIDEO
-  if( m_ext360->isEnabled() )
+  bool isInputEof = false;
+  if (m_inputThread.joinable())
   {
-    m_ext360->read( m_cVideoIOYuvInputFile, *m_orgPic, *m_trueOrgPic, ipCSC );
+    isInputEof = xTakeInputFrame();
   }
   else
   {
-    m_cVideoIOYuvInputFile.read(*m_orgPic, *m_trueOrgPic, ipCSC, m_sourcePadding, m_inputChromaFormatIDC,
-                                m_clipInputVideoToRec709Range);
-  }
+#if EXTENSION_360_VIDEO
+    if( m_ext360->isEnabled() )
+    {
+      m_ext360->read( m_cVideoIOYuvInputFile, *m_orgPic, *m_trueOrgPic, ipCSC );
+    }
+    else
+    {
+      m_cVideoIOYuvInputFile.read(*m_orgPic, *m_trueOrgPic, ipCSC, m_sourcePadding, m_inputChromaFormatIDC,
+                                  m_clipInputVideoToRec709Range);
+    }
 #else
-  if (m_sourceScalingRatioHor != 1.0 || m_sourceScalingRatioVer != 1.0)
-  {
-    int noPadding[2] = { 0 };
-    m_cVideoIOYuvInputFile.read(*m_orgPicBeforeScale, *m_trueOrgPicBeforeScale, ipCSC, noPadding, m_inputChromaFormatIDC,
-                                m_clipInputVideoToRec709Range);
-    int w0 = m_sourceWidthBeforeScale;
-    int h0 = m_sourceHeightBeforeScale;
-    int w1 = m_orgPic->get(COMPONENT_Y).width - m_sourcePadding[0];
-    int h1 = m_orgPic->get(COMPONENT_Y).height - m_sourcePadding[1];
-    int xScale = ((w0 << ScalingRatio::BITS) + (w1 >> 1)) / w1;
-    int yScale = ((h0 << ScalingRatio::BITS) + (h1 >> 1)) / h1;
-    ScalingRatio scalingRatio = { xScale, yScale };
-    Window conformanceWindow1(0, m_sourcePadding[0] / SPS::getWinUnitX(m_inputChromaFormatIDC), 0, m_sourcePadding[1] / SPS::getWinUnitY(m_inputChromaFormatIDC));
-
-    bool downsampling = (m_sourceWidthBeforeScale > m_sourceWidth) || (m_sourceHeightBeforeScale > m_sourceHeight);
-    bool useLumaFilter = downsampling;
-    Picture::rescalePicture(scalingRatio, *m_orgPicBeforeScale, Window(), *m_orgPic, conformanceWindow1,
-                            m_inputChromaFormatIDC, m_internalBitDepth, useLumaFilter, downsampling,
-                            m_horCollocatedChromaFlag != 0, m_verCollocatedChromaFlag != 0);
-    m_trueOrgPic->copyFrom(*m_orgPic);
-  }
-  else
-  {
-    m_cVideoIOYuvInputFile.read(*m_orgPic, *m_trueOrgPic, ipCSC, m_sourcePadding, m_inputChromaFormatIDC,
-                                m_clipInputVideoToRec709Range);
-  }
+    if (m_sourceScalingRatioHor != 1.0 || m_sourceScalingRatioVer != 1.0)
+    {
+      int noPadding[2] = { 0 };
+      m_cVideoIOYuvInputFile.read(*m_orgPicBeforeScale, *m_trueOrgPicBeforeScale, ipCSC, noPadding, m_inputChromaFormatIDC,
+                                  m_clipInputVideoToRec709Range);
+      int w0 = m_sourceWidthBeforeScale;
+      int h0 = m_sourceHeightBeforeScale;
+      int w1 = m_orgPic->get(COMPONENT_Y).width - m_sourcePadding[0];
+      int h1 = m_orgPic->get(COMPONENT_Y).height - m_sourcePadding[1];
+      int xScale = ((w0 << ScalingRatio::BITS) + (w1 >> 1)) / w1;
+      int yScale = ((h0 << ScalingRatio::BITS) + (h1 >> 1)) / h1;
+      ScalingRatio scalingRatio = { xScale, yScale };
+      Window conformanceWindow1(0, m_sourcePadding[0] / SPS::getWinUnitX(m_inputChromaFormatIDC), 0, m_sourcePadding[1] / SPS::getWinUnitY(m_inputChromaFormatIDC));
+
+      bool downsampling = (m_sourceWidthBeforeScale > m_sourceWidth) || (m_sourceHeightBeforeScale > m_sourceHeight);
+      bool useLumaFilter = downsampling;
+      Picture::rescalePicture(scalingRatio, *m_orgPicBeforeScale, Window(), *m_orgPic, conformanceWindow1,
+                              m_inputChromaFormatIDC, m_internalBitDepth, useLumaFilter, downsampling,
+                              m_horCollocatedChromaFlag != 0, m_verCollocatedChromaFlag != 0);
+      m_trueOrgPic->copyFrom(*m_orgPic);
+    }
+    else
+    {
+      m_cVideoIOYuvInputFile.read(*m_orgPic, *m_trueOrgPic, ipCSC, m_sourcePadding, m_inputChromaFormatIDC,
+                                  m_clipInputVideoToRec709Range);
+    }
 #endif
+    isInputEof = m_cVideoIOYuvInputFile.isEof();
+  }
 
   // increase number of received frames
   m_frameRcvd++;
@@ -1942,7 +1958,7 @@ bool EncApp::encodePrep( bool& eos )
     (m_isField && (m_frameRcvd == (m_framesToBeEncoded >> 1))) || (!m_isField && (m_frameRcvd == m_framesToBeEncoded));
 
   // if end of file (which is only detected on a read failure) flush the encoder of any queued pictures
-  if( m_cVideoIOYuvInputFile.isEof() )
+  if( isInputEof )
   {
     m_flush = true;
     eos = true;
@@ -2028,6 +2044,127 @@ void EncApp::applyNnPostFilter()
 // Protected member functions
 // ====================================================================================================================
 
+void EncApp::xStartInputThread()
+{
+  // the frames are read ahead as plain frames only, the other reading modes stay on the encoder thread
+  if (m_numThreads <= 1 || m_sourceScalingRatioHor != 1.0 || m_sourceScalingRatioVer != 1.0
+      || m_temporalSubsampleRatio > 1)
+  {
+    return;
+  }
+#if EXTENSION_360_VIDEO
+  if (m_ext360->isEnabled())
+  {
+    return;
+  }
+#endif
+
+  const int      sourceHeight = m_isField ? m_iSourceHeightOrg : m_sourceHeight;
+  const UnitArea unitArea(m_chromaFormatIdc, Area(0, 0, m_sourceWidth, sourceHeight));
+
+  static const int numInputFrames = 3;
+  for (int i = 0; i < numInputFrames; i++)
+  {
+    std::unique_ptr<InputFrame> frame(new InputFrame);
+    frame->orgPic.create(unitArea);
+    frame->trueOrgPic.create(unitArea);
+    m_freeInputFrames.push_back(std::move(frame));
+  }
+  m_stopInput = false;
+  m_inputThread = std::thread(&EncApp::xReadInput, this, m_isField ? m_framesToBeEncoded >> 1 : m_framesToBeEncoded);
+}
+
+void EncApp::xStopInputThread()
+{
+  if (!m_inputThread.joinable())
+  {
+    return;
+  }
+  {
+    std::unique_lock<std::mutex> lock(m_inputMutex);
+    m_stopInput = true;
+  }
+  m_inputCond.notify_all();
+  m_inputThread.join();
+
+  m_inputQueue.clear();
+  m_freeInputFrames.clear();
+  m_inputException = nullptr;
+}
+
+void EncApp::xReadInput(const int numFrames)
+{
+  const InputColourSpaceConversion ipCSC = m_inputColourSpaceConvert;
+
+  try
+  {
+    for (int i = 0; i < numFrames; i++)
+    {
+      std::unique_ptr<InputFrame> frame;
+      {
+        std::unique_lock<std::mutex> lock(m_inputMutex);
+        m_inputCond.wait(lock, [this] { return m_stopInput || !m_freeInputFrames.empty(); });
+        if (m_stopInput)
+        {
+          return;
+        }
+        frame = std::move(m_freeInputFrames.back());
+        m_freeInputFrames.pop_back();
+      }
+
+      m_cVideoIOYuvInputFile.read(frame->orgPic, frame->trueOrgPic, ipCSC, m_sourcePadding, m_inputChromaFormatIDC,
+                                  m_clipInputVideoToRec709Range);
+      frame->isEof = m_cVideoIOYuvInputFile.isEof();
+      const bool isEof = frame->isEof;
+      {
+        std::unique_lock<std::mutex> lock(m_inputMutex);
+        m_inputQueue.push_back(std::move(frame));
+      }
+      m_inputCond.notify_all();
+
+      if (isEof)
+      {
+        return;
+      }
+    }
+  }
+  catch (...)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_inputMutex);
+      m_inputException = std::current_exception();
+    }
+    m_inputCond.notify_all();
+  }
+}
+
+bool EncApp::xTakeInputFrame()
+{
+  std::unique_ptr<InputFrame> frame;
+  {
+    std::unique_lock<std::mutex> lock(m_inputMutex);
+    m_inputCond.wait(lock, [this] { return !m_inputQueue.empty() || m_inputException; });
+    if (m_inputQueue.empty())
+    {
+      std::rethrow_exception(m_inputException);
+    }
+    frame = std::move(m_inputQueue.front());
+    m_inputQueue.pop_front();
+  }
+
+  // the buffers returned by the encoder are pooled for the frames to come
+  m_orgPic->swap(frame->orgPic);
+  m_trueOrgPic->swap(frame->trueOrgPic);
+  const bool isEof = frame->isEof;
+  {
+    std::unique_lock<std::mutex> lock(m_inputMutex);
+    m_freeInputFrames.push_back(std::move(frame));
+  }
+  m_inputCond.notify_all();
+
+  return isEof;
+}
+
 /**
   Write access units to output file.
   \param bitstreamFile  target bitstream file
@@ -38,8 +38,14 @@
 #ifndef __ENCAPP__
 #define __ENCAPP__
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <ostream>
+#include <thread>
 
 #include "EncoderLib/EncLib.h"
 #include "Utilities/VideoIOYuv.h"
@@ -108,6 +114,26 @@ private:
   FeatureCounterStruct      m_featureCounter;
 #endif
 
+  // input read ahead
+  struct InputFrame
+  {
+    PelStorage orgPic;
+    PelStorage trueOrgPic;
+    bool       isEof = false;   ///< the end of the input file was reached instead of reading the frame
+  };
+  std::thread                              m_inputThread;       ///< thread reading the input file ahead of the encoder (not joinable: none)
+  std::mutex                               m_inputMutex;
+  std::condition_variable                  m_inputCond;
+  std::deque<std::unique_ptr<InputFrame>>  m_inputQueue;        ///< frames read ahead, in input order
+  std::vector<std::unique_ptr<InputFrame>> m_freeInputFrames;   ///< pooled frame buffers to read the next frames into
+  std::exception_ptr                       m_inputException;    ///< error of the input thread, raised when its frame is taken
+  bool                                     m_stopInput;
+
+  void xStartInputThread();                      ///< start reading the input file ahead, when possible
+  void xStopInputThread();
+  void xReadInput(const int numFrames);          ///< input thread function
+  bool xTakeInputFrame();                        ///< swap the next frame read ahead into the original buffers, returns the end of file flag
+
 public:
   EncApp(std::fstream &bitStream, EncLibCommon *encLibCommon);
   virtual ~EncApp();
@@ -46,6 +46,7 @@
 
 #include "Utilities/program_options_lite.h"
 #include "Utilities/VideoIOYuv.h"
+#include "Utilities/StreamIO.h"
 #include "CommonLib/Rom.h"
 #include "EncoderLib/RateCtrl.h"
 
@@ -847,10 +848,10 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
   ("SIMD",                                            ignore,                                      std::string(""), "SIMD extension to use (SCALAR, SSE41, SSE42, AVX, AVX2, AVX512), default: the highest supported extension\n")
 #endif
   // File, I/O and source parameters
-  ("InputFile,i",                                     m_inputFileName,                             std::string(""), "Original YUV input file name")
+  ("InputFile,i",                                     m_inputFileName,                             std::string(""), "Original YUV input file name (-: standard input)")
   ("InputPathPrefix,-ipp",                            inputPathPrefix,                             std::string(""), "pathname to prepend to input filename")
-  ("BitstreamFile,b",                                 m_bitstreamFileName,                         std::string(""), "Bitstream output file name")
-  ("ReconFile,o",                                     m_reconFileName,                             std::string(""), "Reconstructed YUV output file name")
+  ("BitstreamFile,b",                                 m_bitstreamFileName,                         std::string(""), "Bitstream output file name (-: standard output)")
+  ("ReconFile,o",                                     m_reconFileName,                             std::string(""), "Reconstructed YUV output file name (-: standard output)")
   ("SEIShutterIntervalPreFilename,-sii",              m_shutterIntervalPreFileName, std::string(""), "File name of Pre-Filtering video. If empty, not output video\n")
   ("SourceWidth,-wdt",                                m_sourceWidth,                                       0, "Source picture width")
   ("SourceHeight,-hgt",                               m_sourceHeight,                                      0, "Source picture height")
@@ -1345,6 +1346,7 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
   ("WeightedPredMethod,-wpM",                         tmpWeightedPredictionMethod, int(WP_PER_PICTURE_WITH_SIMPLE_DC_COMBINED_COMPONENT), "Weighted prediction method")
   ("Log2ParallelMergeLevel",                          m_log2ParallelMergeLevel,                            2u, "Parallel merge estimation region")
   ("WaveFrontSynchro",                                m_entropyCodingSyncEnabledFlag,                   false, "0: entropy coding sync disabled; 1 entropy coding sync enabled")
+  ("Threads",                                         m_numThreads,                                         0, "Number of threads encoding the CTU lines of wavefront parallel slices and the tiles, and running the temporal filter, the ALF/SAO statistics and the quality metrics concurrently, and reading the input file ahead (0 or 1: single-threaded)")
   ("EntryPointsPresent",                              m_entryPointPresentFlag,                           true, "0: entry points is not present; 1 entry points may be present in slice header")
   ("ScalingList",                                     m_useScalingListId,                    SCALING_LIST_OFF, "0/off: no scaling list, 1/default: default scaling lists, 2/file: scaling lists specified in ScalingListFile")
   ("ScalingListFile",                                 m_scalingListFileName,                       std::string(""), "Scaling list file name. Use an empty string to produce help.")
@@ -4523,6 +4525,12 @@ bool EncAppCfg::xCheckParameter()
 
 
   xConfirmPara(m_bitstreamFileName.empty(), "A bitstream file name must be specified (BitstreamFile)");
+  xConfirmPara(isStdStreamFileName(m_bitstreamFileName) && isStdStreamFileName(m_reconFileName),
+               "The bitstream and the reconstructed YUV cannot both be written to the standard output");
+  xConfirmPara(isStdStreamFileName(m_inputFileName)
+                 && (m_gopBasedTemporalFilterEnabled || m_bimEnabled
+                     || (m_fgcSEIAnalysisEnabled && m_fgcSEIExternalDenoised.empty())),
+               "The temporal filter reads the input file again and cannot be used with the standard input");
   xConfirmPara(m_internalBitDepth[ChannelType::CHROMA] != m_internalBitDepth[ChannelType::LUMA],
                "The internalBitDepth must be the same for luma and chroma");
   if (m_profile != Profile::NONE)
@@ -6206,6 +6214,7 @@ void EncAppCfg::xPrintParameter()
     m_entropyCodingSyncEnabledFlag ? (m_sourceHeight + m_maxCuHeight - 1) / m_maxCuHeight : 1;
   msg(VERBOSE, " WaveFrontSynchro:%d WaveFrontSubstreams:%d", m_entropyCodingSyncEnabledFlag ? 1 : 0,
       wavefrontSubstreams);
+  msg( VERBOSE, " Threads:%d ", m_numThreads );
   msg( VERBOSE, " ScalingList:%d ", m_useScalingListId );
   msg( VERBOSE, "TMVPMode:%d ", m_TMVPModeId );
   msg( VERBOSE, " DQ:%d ", m_depQuantEnabledFlag);
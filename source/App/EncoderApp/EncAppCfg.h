@@ -516,6 +516,7 @@ protected:
   bool      m_singleSlicePerSubPicFlag;
   bool      m_entropyCodingSyncEnabledFlag;
   bool      m_entryPointPresentFlag;                          ///< flag for the presence of entry points
+  int       m_numThreads;                                     ///< number of threads encoding wavefront CTU lines and tiles and running the temporal filter, ALF/SAO statistics and quality metrics concurrently, and reading the input ahead
 
   bool      m_bFastUDIUseMPMEnabled;
   bool      m_bFastMEForGenBLowDelayEnabled;
@@ -43,6 +43,7 @@
 #include "EncoderLib/EncLibCommon.h"
 #include "EncApp.h"
 #include "Utilities/program_options_lite.h"
+#include "Utilities/StreamIO.h"
 
 //! \ingroup EncoderApp
 //! \{
@@ -107,6 +108,21 @@ int getProcStatusValue(const char* key)
 
 int main(int argc, char* argv[])
 {
+  // an output to the standard output leaves it to the data, the messages go to the standard error
+  {
+    std::string bitstreamFileName;
+    std::string reconFileName;
+    ProgramOptionsLite::Options optsOutput;
+    optsOutput.addOptions()("BitstreamFile,b", bitstreamFileName, std::string(""), "")(
+      "ReconFile,o", reconFileName, std::string(""), "")("c", ProgramOptionsLite::parseConfigFile, "");
+    ProgramOptionsLite::SilentReporter errOutput;
+    ProgramOptionsLite::scanArgv(optsOutput, argc, (const char**) argv, errOutput);
+    if (isStdStreamFileName(bitstreamFileName) || isStdStreamFileName(reconFileName))
+    {
+      redirectMessagesToStdErr();
+    }
+  }
+
   // print information
   fprintf( stdout, "\n" );
   fprintf( stdout, "VVCSoftware: VTM Encoder Version %s ", VTM_VERSION );
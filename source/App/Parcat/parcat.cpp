@@ -37,6 +37,7 @@
 #include <cstdio>
 #include <cassert>
 #include "CommonLib/CommonDef.h"
+#include "DecoderLib/AnnexBread.h"
 #include "DecoderLib/NALread.h"
 #include "VLCReader.h"
 #if ENABLE_TRACING
@@ -123,15 +124,8 @@ int find_nal_unit(const uint8_t* buf, int size, int* nal_start, int* nal_end)
   i+= 3;
   *nal_start = i;
 
-  while (//( next_bits( 24 ) != 0x000000 && next_bits( 24 ) != 0x000001 )
-    i+3 < size &&
-    (buf[i] != 0 || buf[i+1] != 0 || buf[i+2] != 0) &&
-    (buf[i] != 0 || buf[i+1] != 0 || buf[i+2] != 0x01)
-    )
-  {
-    i++;
-    // FIXME the next line fails when reading a nal that ends exactly at the end of the data
-  }
+  // ( next_bits( 24 ) != 0x000000 && next_bits( 24 ) != 0x000001 )
+  i = std::min(int(findNalUnitEnd(buf + i, buf + size) - buf), std::max(i, size - 3));
 
   if (i+3 == size)
   {
@@ -210,7 +210,7 @@ bool StreamMergeApp::isNewPicture(std::ifstream *bitstreamFile, InputByteStream
   }
 
   // save stream position for backup
-  std::streampos location = bitstreamFile->tellg();
+  bytestream->startLookahead();
 
   // look ahead until picture start location is determined
   while (!finished && !!(*bitstreamFile))
@@ -282,10 +282,9 @@ bool StreamMergeApp::isNewPicture(std::ifstream *bitstreamFile, InputByteStream
     }
   }
 
-  // restore previous stream location - minus 3 due to the need for the annexB parser to read three extra bytes
+  // restore previous stream position
   bitstreamFile->clear();
-  bitstreamFile->seekg(location - std::streamoff(3));
-  bytestream->reset();
+  bytestream->endLookahead();
 
   // return TRUE if next NAL unit is the start of a new picture
   return ret;
@@ -306,7 +305,7 @@ bool StreamMergeApp::isNewAccessUnit(bool newPicture, std::ifstream *bitstreamFi
   }
 
   // save stream position for backup
-  std::streampos location = bitstreamFile->tellg();
+  bytestream->startLookahead();
 
   // look ahead until access unit start location is determined
   while (!finished && !!(*bitstreamFile))
@@ -359,10 +358,9 @@ bool StreamMergeApp::isNewAccessUnit(bool newPicture, std::ifstream *bitstreamFi
     }
   }
 
-  // restore previous stream location
+  // restore previous stream position
   bitstreamFile->clear();
-  bitstreamFile->seekg(location);
-  bytestream->reset();
+  bytestream->endLookahead();
 
   // return TRUE if next NAL unit is the start of a new picture
   return ret;
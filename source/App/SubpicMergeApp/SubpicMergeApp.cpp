@@ -147,10 +147,8 @@ bool SubpicMergeApp::isNewPicture(std::ifstream *bitstreamFile, InputByteStream
   // save stream position for backup
 #if RExt__DECODER_DEBUG_STATISTICS
   CodingStatistics::CodingStatisticsData* backupStats = new CodingStatistics::CodingStatisticsData(CodingStatistics::GetStatistics());
-  std::streampos location = bitstreamFile->tellg() - std::streampos(bytestream->getNumBufferedBytes());
-#else
-  std::streampos location = bitstreamFile->tellg();
 #endif
+  bytestream->startLookahead();
 
   // look ahead until picture start location is determined
   while (!finished && !!(*bitstreamFile))
@@ -222,17 +220,12 @@ bool SubpicMergeApp::isNewPicture(std::ifstream *bitstreamFile, InputByteStream
     }
   }
 
-  // restore previous stream location - minus 3 due to the need for the annexB parser to read three extra bytes
-#if RExt__DECODER_DEBUG_BIT_STATISTICS
+  // restore previous stream position
   bitstreamFile->clear();
-  bitstreamFile->seekg(location);
-  bytestream->reset();
+  bytestream->endLookahead();
+#if RExt__DECODER_DEBUG_BIT_STATISTICS
   CodingStatistics::SetStatistics(*backupStats);
   delete backupStats;
-#else
-  bitstreamFile->clear();
-  bitstreamFile->seekg(location-std::streamoff(3));
-  bytestream->reset();
 #endif
 
   // return TRUE if next NAL unit is the start of a new picture
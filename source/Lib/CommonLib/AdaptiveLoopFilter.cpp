@@ -114,11 +114,10 @@ bool AdaptiveLoopFilter::isCrossedByVirtualBoundaries( const CodingStructure& cs
     }
   }
 
-  const Slice& slice = *(cs.slice);
-  int   ctuSize = slice.getSPS()->getCTUSize();
+  int   ctuSize = cs.sps->getCTUSize();
   const Position currCtuPos(xPos, yPos);
   const CodingUnit *currCtu   = cs.getCU(currCtuPos, ChannelType::LUMA);
-  const SubPic& curSubPic = slice.getPPS()->getSubPicFromPos(currCtuPos);
+  const SubPic& curSubPic = pps->getSubPicFromPos(currCtuPos);
 
   bool loopFilterAcrossSubPicEnabledFlag = curSubPic.getloopFilterAcrossEnabledFlag();
   //top
@@ -373,235 +372,285 @@ void AdaptiveLoopFilter::applyCcAlfFilter(CodingStructure& cs, ComponentID compI
 
 void AdaptiveLoopFilter::ALFProcess(CodingStructure& cs)
 {
+  PelUnitBuf recYuv = cs.getRecoBuf();
+  m_tempBuf.copyFrom( recYuv );
+  PelUnitBuf tmpYuv = m_tempBuf.getBuf( cs.area );
+  tmpYuv.extendBorderPel( MAX_ALF_FILTER_LENGTH >> 1 );
+
+  for( int ctuRow = 0; ctuRow < cs.pcv->heightInCtus; ctuRow++ )
+  {
+    // leave the last slice whose ALF parameters were loaded active, as when activating it for loading them
+    Slice* lastSlice = xFilterCtuRow( cs, tmpYuv, ctuRow );
+    cs.slice         = lastSlice != nullptr ? lastSlice : cs.slice;
+  }
+}
+
+Slice* AdaptiveLoopFilter::ALFProcessCtuRow(CodingStructure& cs, const int ctuRow)
+{
+  const PreCalcValues& pcv    = *cs.pcv;
+  const int            margin = MAX_ALF_FILTER_LENGTH >> 1;
+
+  // the SAO output of this row and of the first lines of the row below, which are read across the virtual boundary
+  // of the last CTU line, the lines above have been copied by the previous row
+  const int      yPos     = ctuRow * pcv.maxCUHeight;
+  const int      copyEnd  = std::min<int>( yPos + pcv.maxCUHeight + MAX_ALF_PADDING_SIZE, pcv.lumaHeight );
+  const UnitArea copyArea( pcv.chrFormat, Area( 0, yPos, pcv.lumaWidth, copyEnd - yPos ) );
+  PelUnitBuf     tmpYuv = m_tempBuf.getBuf( cs.area );
+  tmpYuv.subBuf( copyArea ).copyFrom( cs.getRecoBuf().subBuf( copyArea ) );
+
+  for( uint32_t compIdx = 0; compIdx < getNumberValidComponents( pcv.chrFormat ); compIdx++ )
+  {
+    PelBuf     picBuf = tmpYuv.bufs[compIdx];
+    PelBuf     rowBuf = tmpYuv.subBuf( copyArea ).bufs[compIdx];
+    const bool top    = ctuRow == 0;
+    const bool bottom = copyEnd == pcv.lumaHeight;
+    rowBuf.extendBorderPel( margin, 0 );
+    for( int y = 0; y < margin; y++ )
+    {
+      if( top )
+      {
+        ::memcpy( picBuf.bufAt( -margin, -1 - y ), picBuf.bufAt( -margin, 0 ), sizeof( Pel ) * ( picBuf.width + 2 * margin ) );
+      }
+      if( bottom )
+      {
+        ::memcpy( picBuf.bufAt( -margin, picBuf.height + y ), picBuf.bufAt( -margin, picBuf.height - 1 ), sizeof( Pel ) * ( picBuf.width + 2 * margin ) );
+      }
+    }
+  }
 
-  // set clipping range
-  m_clpRngs = cs.slice->getClpRngs();
+  return xFilterCtuRow( cs, tmpYuv, ctuRow );
+}
 
+Slice* AdaptiveLoopFilter::xFilterCtuRow(CodingStructure& cs, const PelUnitBuf& tmpYuv, const int ctuRow)
+{
   // set CTU enable flags
   for( int compIdx = 0; compIdx < MAX_NUM_COMPONENT; compIdx++ )
   {
     m_modes[compIdx] = cs.picture->getAlfModes(compIdx);
   }
-  AlfMode *lumaModes    = nullptr;
-  uint32_t lastSliceIdx = 0xFFFFFFFF;
+  AlfMode     *lumaModes    = nullptr;
+  uint32_t     lastSliceIdx = 0xFFFFFFFF;
+  Slice       *lastSlice    = nullptr;
 
   PelUnitBuf recYuv = cs.getRecoBuf();
-  m_tempBuf.copyFrom( recYuv );
-  PelUnitBuf tmpYuv = m_tempBuf.getBuf( cs.area );
-  tmpYuv.extendBorderPel( MAX_ALF_FILTER_LENGTH >> 1 );
 
   const PreCalcValues& pcv = *cs.pcv;
 
-  int ctuIdx = 0;
+  const int yPos   = ctuRow * pcv.maxCUHeight;
+  int       ctuIdx = ctuRow * pcv.widthInCtus;
   bool clipTop = false, clipBottom = false, clipLeft = false, clipRight = false;
   int numHorVirBndry = 0, numVerVirBndry = 0;
   int horVirBndryPos[] = { 0, 0, 0 };
   int verVirBndryPos[] = { 0, 0, 0 };
 
-  for( int yPos = 0; yPos < pcv.lumaHeight; yPos += pcv.maxCUHeight )
+  for( int xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth )
   {
-    for( int xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth )
-    {
-      // get first CU in CTU
-      const CodingUnit *cu = cs.getCU(Position(xPos, yPos), ChannelType::LUMA);
+    // get first CU in CTU
+    const CodingUnit *cu = cs.getCU(Position(xPos, yPos), ChannelType::LUMA);
 
-      // skip this CTU if ALF is disabled
-      if (!cu->slice->getAlfEnabledFlag(COMPONENT_Y) && !cu->slice->getAlfEnabledFlag(COMPONENT_Cb) && !cu->slice->getAlfEnabledFlag(COMPONENT_Cr))
-      {
-        ctuIdx++;
-        continue;
-      }
+    // skip this CTU if ALF is disabled
+    if (!cu->slice->getAlfEnabledFlag(COMPONENT_Y) && !cu->slice->getAlfEnabledFlag(COMPONENT_Cb) && !cu->slice->getAlfEnabledFlag(COMPONENT_Cr))
+    {
+      ctuIdx++;
+      continue;
+    }
 
-      // reload ALF APS each time the slice changes during raster scan filtering
-      if (ctuIdx == 0 || lastSliceIdx != cu->slice->getSliceID() || lumaModes == nullptr)
-      {
-        cs.slice = cu->slice;
-        reconstructCoeffAPSs(cs, true, cu->slice->getAlfEnabledFlag(COMPONENT_Cb) || cu->slice->getAlfEnabledFlag(COMPONENT_Cr), false);
-        lumaModes          = cu->slice->getPic()->getAlfModes(COMPONENT_Y);
-        m_ccAlfFilterParam = cu->slice->m_ccAlfFilterParam;
-      }
-      lastSliceIdx = cu->slice->getSliceID();
+    // reload ALF APS each time the slice changes during raster scan filtering
+    if (lastSliceIdx != cu->slice->getSliceID() || lumaModes == nullptr)
+    {
+      m_clpRngs = cu->slice->getClpRngs();
+      reconstructCoeffAPSs(*cu->slice, true, cu->slice->getAlfEnabledFlag(COMPONENT_Cb) || cu->slice->getAlfEnabledFlag(COMPONENT_Cr), false);
+      lumaModes          = cu->slice->getPic()->getAlfModes(COMPONENT_Y);
+      m_ccAlfFilterParam = cu->slice->m_ccAlfFilterParam;
+      lastSlice          = cu->slice;
+    }
+    lastSliceIdx = cu->slice->getSliceID();
 
-      const int width = ( xPos + pcv.maxCUWidth > pcv.lumaWidth ) ? ( pcv.lumaWidth - xPos ) : pcv.maxCUWidth;
-      const int height = ( yPos + pcv.maxCUHeight > pcv.lumaHeight ) ? ( pcv.lumaHeight - yPos ) : pcv.maxCUHeight;
-      bool      ctuEnableFlag = m_modes[COMPONENT_Y][ctuIdx] != AlfMode::OFF;
-      for( int compIdx = 1; compIdx < MAX_NUM_COMPONENT; compIdx++ )
+    const int width = ( xPos + pcv.maxCUWidth > pcv.lumaWidth ) ? ( pcv.lumaWidth - xPos ) : pcv.maxCUWidth;
+    const int height = ( yPos + pcv.maxCUHeight > pcv.lumaHeight ) ? ( pcv.lumaHeight - yPos ) : pcv.maxCUHeight;
+    bool      ctuEnableFlag = m_modes[COMPONENT_Y][ctuIdx] != AlfMode::OFF;
+    for( int compIdx = 1; compIdx < MAX_NUM_COMPONENT; compIdx++ )
+    {
+      ctuEnableFlag |= m_modes[compIdx][ctuIdx] != AlfMode::OFF;
+      if (cu->slice->m_ccAlfFilterParam.ccAlfFilterEnabled[compIdx - 1])
       {
-        ctuEnableFlag |= m_modes[compIdx][ctuIdx] != AlfMode::OFF;
-        if (cu->slice->m_ccAlfFilterParam.ccAlfFilterEnabled[compIdx - 1])
-        {
-          ctuEnableFlag |= m_ccAlfFilterControl[compIdx - 1][ctuIdx] > 0;
-        }
+        ctuEnableFlag |= m_ccAlfFilterControl[compIdx - 1][ctuIdx] > 0;
       }
-      int rasterSliceAlfPad = 0;
-      if( ctuEnableFlag && isCrossedByVirtualBoundaries( cs, xPos, yPos, width, height, clipTop, clipBottom, clipLeft, clipRight, numHorVirBndry, numVerVirBndry, horVirBndryPos, verVirBndryPos, rasterSliceAlfPad ) )
+    }
+    int rasterSliceAlfPad = 0;
+    if( ctuEnableFlag && isCrossedByVirtualBoundaries( cs, xPos, yPos, width, height, clipTop, clipBottom, clipLeft, clipRight, numHorVirBndry, numVerVirBndry, horVirBndryPos, verVirBndryPos, rasterSliceAlfPad ) )
+    {
+      int yStart = yPos;
+      for( int i = 0; i <= numHorVirBndry; i++ )
       {
-        int yStart = yPos;
-        for( int i = 0; i <= numHorVirBndry; i++ )
+        const int yEnd = i == numHorVirBndry ? yPos + height : horVirBndryPos[i];
+        const int h = yEnd - yStart;
+        const bool clipT = ( i == 0 && clipTop ) || ( i > 0 ) || ( yStart == 0 );
+        const bool clipB = ( i == numHorVirBndry && clipBottom ) || ( i < numHorVirBndry ) || ( yEnd == pcv.lumaHeight );
+        int xStart = xPos;
+        for( int j = 0; j <= numVerVirBndry; j++ )
         {
-          const int yEnd = i == numHorVirBndry ? yPos + height : horVirBndryPos[i];
-          const int h = yEnd - yStart;
-          const bool clipT = ( i == 0 && clipTop ) || ( i > 0 ) || ( yStart == 0 );
-          const bool clipB = ( i == numHorVirBndry && clipBottom ) || ( i < numHorVirBndry ) || ( yEnd == pcv.lumaHeight );
-          int xStart = xPos;
-          for( int j = 0; j <= numVerVirBndry; j++ )
+          const int xEnd = j == numVerVirBndry ? xPos + width : verVirBndryPos[j];
+          const int w = xEnd - xStart;
+          const bool clipL = ( j == 0 && clipLeft ) || ( j > 0 ) || ( xStart == 0 );
+          const bool clipR = ( j == numVerVirBndry && clipRight ) || ( j < numVerVirBndry ) || ( xEnd == pcv.lumaWidth );
+          const int wBuf = w + (clipL ? 0 : MAX_ALF_PADDING_SIZE) + (clipR ? 0 : MAX_ALF_PADDING_SIZE);
+          const int hBuf = h + (clipT ? 0 : MAX_ALF_PADDING_SIZE) + (clipB ? 0 : MAX_ALF_PADDING_SIZE);
+          PelUnitBuf buf = m_tempBuf2.subBuf( UnitArea( cs.area.chromaFormat, Area( 0, 0, wBuf, hBuf ) ) );
+          buf.copyFrom( tmpYuv.subBuf( UnitArea( cs.area.chromaFormat, Area( xStart - (clipL ? 0 : MAX_ALF_PADDING_SIZE), yStart - (clipT ? 0 : MAX_ALF_PADDING_SIZE), wBuf, hBuf ) ) ) );
+          // pad top-left unavailable samples for raster slice
+          if ( xStart == xPos && yStart == yPos && ( rasterSliceAlfPad & 1 ) )
           {
-            const int xEnd = j == numVerVirBndry ? xPos + width : verVirBndryPos[j];
-            const int w = xEnd - xStart;
-            const bool clipL = ( j == 0 && clipLeft ) || ( j > 0 ) || ( xStart == 0 );
-            const bool clipR = ( j == numVerVirBndry && clipRight ) || ( j < numVerVirBndry ) || ( xEnd == pcv.lumaWidth );
-            const int wBuf = w + (clipL ? 0 : MAX_ALF_PADDING_SIZE) + (clipR ? 0 : MAX_ALF_PADDING_SIZE);
-            const int hBuf = h + (clipT ? 0 : MAX_ALF_PADDING_SIZE) + (clipB ? 0 : MAX_ALF_PADDING_SIZE);
-            PelUnitBuf buf = m_tempBuf2.subBuf( UnitArea( cs.area.chromaFormat, Area( 0, 0, wBuf, hBuf ) ) );
-            buf.copyFrom( tmpYuv.subBuf( UnitArea( cs.area.chromaFormat, Area( xStart - (clipL ? 0 : MAX_ALF_PADDING_SIZE), yStart - (clipT ? 0 : MAX_ALF_PADDING_SIZE), wBuf, hBuf ) ) ) );
-            // pad top-left unavailable samples for raster slice
-            if ( xStart == xPos && yStart == yPos && ( rasterSliceAlfPad & 1 ) )
-            {
-              buf.padBorderPel( MAX_ALF_PADDING_SIZE, 1 );
-            }
+            buf.padBorderPel( MAX_ALF_PADDING_SIZE, 1 );
+          }
 
-            // pad bottom-right unavailable samples for raster slice
-            if ( xEnd == xPos + width && yEnd == yPos + height && ( rasterSliceAlfPad & 2 ) )
-            {
-              buf.padBorderPel( MAX_ALF_PADDING_SIZE, 2 );
-            }
-            buf.extendBorderPel( MAX_ALF_PADDING_SIZE );
-            buf = buf.subBuf( UnitArea ( cs.area.chromaFormat, Area( clipL ? 0 : MAX_ALF_PADDING_SIZE, clipT ? 0 : MAX_ALF_PADDING_SIZE, w, h ) ) );
+          // pad bottom-right unavailable samples for raster slice
+          if ( xEnd == xPos + width && yEnd == yPos + height && ( rasterSliceAlfPad & 2 ) )
+          {
+            buf.padBorderPel( MAX_ALF_PADDING_SIZE, 2 );
+          }
+          buf.extendBorderPel( MAX_ALF_PADDING_SIZE );
+          buf = buf.subBuf( UnitArea ( cs.area.chromaFormat, Area( clipL ? 0 : MAX_ALF_PADDING_SIZE, clipT ? 0 : MAX_ALF_PADDING_SIZE, w, h ) ) );
 
-            if (m_modes[COMPONENT_Y][ctuIdx] != AlfMode::OFF)
-            {
-              const Area blkSrc( 0, 0, w, h );
-              const Area blkDst( xStart, yStart, w, h );
-              deriveClassification( m_classifier, buf.get(COMPONENT_Y), blkDst, blkSrc );
-              const AlfMode m     = lumaModes[ctuIdx];
-              const AlfCoeff* coeff = getCoeffVals(m);
-              const Pel*    clip  = getClipVals(m);
+          if (m_modes[COMPONENT_Y][ctuIdx] != AlfMode::OFF)
+          {
+            const Area blkSrc( 0, 0, w, h );
+            const Area blkDst( xStart, yStart, w, h );
+            deriveClassification( m_classifier, buf.get(COMPONENT_Y), blkDst, blkSrc );
+            const AlfMode m     = lumaModes[ctuIdx];
+            const AlfCoeff* coeff = getCoeffVals(m);
+            const Pel*    clip  = getClipVals(m);
 #if GREEN_METADATA_SEI_ENABLED
-              cs.m_featureCounter.alfLumaType7+= (width * height / 16) ;
-              cs.m_featureCounter.alfLumaPels += (width * height);
+            cs.m_featureCounter.alfLumaType7+= (width * height / 16) ;
+            cs.m_featureCounter.alfLumaPels += (width * height);
 #endif
-              m_filter7x7Blk(m_classifier, recYuv, buf, blkDst, blkSrc, COMPONENT_Y, coeff, clip, m_clpRngs.comp[COMPONENT_Y], cs
-                , m_alfVBLumaCTUHeight
-                , m_alfVBLumaPos
-              );
-            }
+            m_filter7x7Blk(m_classifier, recYuv, buf, blkDst, blkSrc, COMPONENT_Y, coeff, clip, m_clpRngs.comp[COMPONENT_Y], cs
+              , m_alfVBLumaCTUHeight
+              , m_alfVBLumaPos
+            );
+          }
 
-            for( int compIdx = 1; compIdx < MAX_NUM_COMPONENT; compIdx++ )
-            {
-              ComponentID compID = ComponentID( compIdx );
-              const int chromaScaleX = getComponentScaleX( compID, tmpYuv.chromaFormat );
-              const int chromaScaleY = getComponentScaleY( compID, tmpYuv.chromaFormat );
+          for( int compIdx = 1; compIdx < MAX_NUM_COMPONENT; compIdx++ )
+          {
+            ComponentID compID = ComponentID( compIdx );
+            const int chromaScaleX = getComponentScaleX( compID, tmpYuv.chromaFormat );
+            const int chromaScaleY = getComponentScaleY( compID, tmpYuv.chromaFormat );
 
-              if (m_modes[compIdx][ctuIdx] != AlfMode::OFF)
-              {
-                const Area blkSrc( 0, 0, w >> chromaScaleX, h >> chromaScaleY );
-                const Area blkDst( xStart >> chromaScaleX, yStart >> chromaScaleY, w >> chromaScaleX, h >> chromaScaleY );
-                const int  altNum = m_modes[compIdx][ctuIdx] - AlfMode::CHROMA0;
-                m_filter5x5Blk(m_classifier, recYuv, buf, blkDst, blkSrc, compID, m_chromaCoeffFinal[altNum],
-                               m_chromaClipValsFinal[altNum], m_clpRngs.comp[compIdx], cs, m_alfVBChmaCTUHeight,
-                               m_alfVBChmaPos);
+            if (m_modes[compIdx][ctuIdx] != AlfMode::OFF)
+            {
+              const Area blkSrc( 0, 0, w >> chromaScaleX, h >> chromaScaleY );
+              const Area blkDst( xStart >> chromaScaleX, yStart >> chromaScaleY, w >> chromaScaleX, h >> chromaScaleY );
+              const int  altNum = m_modes[compIdx][ctuIdx] - AlfMode::CHROMA0;
+              m_filter5x5Blk(m_classifier, recYuv, buf, blkDst, blkSrc, compID, m_chromaCoeffFinal[altNum],
+                             m_chromaClipValsFinal[altNum], m_clpRngs.comp[compIdx], cs, m_alfVBChmaCTUHeight,
+                             m_alfVBChmaPos);
 #if GREEN_METADATA_SEI_ENABLED
-                cs.m_featureCounter.alfChromaType5+= ((width >> chromaScaleX) * (height >> chromaScaleY) / 16) ;
-                cs.m_featureCounter.alfChromaPels += ((width >> chromaScaleX) * (height >> chromaScaleY)) ;
+              cs.m_featureCounter.alfChromaType5+= ((width >> chromaScaleX) * (height >> chromaScaleY) / 16) ;
+              cs.m_featureCounter.alfChromaPels += ((width >> chromaScaleX) * (height >> chromaScaleY)) ;
 #endif
-              }
-              if (cu->slice->m_ccAlfFilterParam.ccAlfFilterEnabled[compIdx - 1])
-              {
-                const int filterIdx = m_ccAlfFilterControl[compIdx - 1][ctuIdx];
+            }
+            if (cu->slice->m_ccAlfFilterParam.ccAlfFilterEnabled[compIdx - 1])
+            {
+              const int filterIdx = m_ccAlfFilterControl[compIdx - 1][ctuIdx];
 
-                if (filterIdx != 0)
-                {
-                  const Area blkSrc(0, 0, w, h);
-                  Area blkDst(xStart >> chromaScaleX, yStart >> chromaScaleY, w >> chromaScaleX, h >> chromaScaleY);
+              if (filterIdx != 0)
+              {
+                const Area blkSrc(0, 0, w, h);
+                Area blkDst(xStart >> chromaScaleX, yStart >> chromaScaleY, w >> chromaScaleX, h >> chromaScaleY);
 
-                  const AlfCoeff* filterCoeff = m_ccAlfFilterParam.ccAlfCoeff[compIdx - 1][filterIdx - 1];
+                const AlfCoeff* filterCoeff = m_ccAlfFilterParam.ccAlfCoeff[compIdx - 1][filterIdx - 1];
 #if GREEN_METADATA_SEI_ENABLED
-                  cs.m_featureCounter.alfLumaType7+= (width * height / 16) ;
-                  cs.m_featureCounter.alfLumaPels += (width * height);
+                cs.m_featureCounter.alfLumaType7+= (width * height / 16) ;
+                cs.m_featureCounter.alfLumaPels += (width * height);
 #endif
-                  m_filterCcAlf(recYuv.get(compID), buf, blkDst, blkSrc, compID, filterCoeff, m_clpRngs, cs,
-                                m_alfVBLumaCTUHeight, m_alfVBLumaPos);
-                }
+                m_filterCcAlf(recYuv.get(compID), buf, blkDst, blkSrc, compID, filterCoeff, m_clpRngs, cs,
+                              m_alfVBLumaCTUHeight, m_alfVBLumaPos);
               }
             }
-
-            xStart = xEnd;
           }
 
-          yStart = yEnd;
+          xStart = xEnd;
         }
+
+        yStart = yEnd;
       }
-      else
+    }
+    else
+    {
+      const UnitArea area( cs.area.chromaFormat, Area( xPos, yPos, width, height ) );
+      if (m_modes[COMPONENT_Y][ctuIdx] != AlfMode::OFF)
       {
-        const UnitArea area( cs.area.chromaFormat, Area( xPos, yPos, width, height ) );
-        if (m_modes[COMPONENT_Y][ctuIdx] != AlfMode::OFF)
-        {
-          Area blk( xPos, yPos, width, height );
-          deriveClassification( m_classifier, tmpYuv.get( COMPONENT_Y ), blk, blk );
-          const AlfMode m     = lumaModes[ctuIdx];
-          const AlfCoeff* coeff = getCoeffVals(m);
-          const Pel*    clip  = getClipVals(m);
+        Area blk( xPos, yPos, width, height );
+        deriveClassification( m_classifier, tmpYuv.get( COMPONENT_Y ), blk, blk );
+        const AlfMode m     = lumaModes[ctuIdx];
+        const AlfCoeff* coeff = getCoeffVals(m);
+        const Pel*    clip  = getClipVals(m);
 #if GREEN_METADATA_SEI_ENABLED
-          cs.m_featureCounter.alfLumaType7+= (width * height / 16) ;
-          cs.m_featureCounter.alfLumaPels += (width * height);
+        cs.m_featureCounter.alfLumaType7+= (width * height / 16) ;
+        cs.m_featureCounter.alfLumaPels += (width * height);
 #endif
-          m_filter7x7Blk(m_classifier, recYuv, tmpYuv, blk, blk, COMPONENT_Y, coeff, clip, m_clpRngs.comp[COMPONENT_Y],
-                         cs, m_alfVBLumaCTUHeight, m_alfVBLumaPos);
-        }
+        m_filter7x7Blk(m_classifier, recYuv, tmpYuv, blk, blk, COMPONENT_Y, coeff, clip, m_clpRngs.comp[COMPONENT_Y],
+                       cs, m_alfVBLumaCTUHeight, m_alfVBLumaPos);
+      }
 
-        for( int compIdx = 1; compIdx < MAX_NUM_COMPONENT; compIdx++ )
-        {
-          ComponentID compID = ComponentID( compIdx );
-          const int chromaScaleX = getComponentScaleX( compID, tmpYuv.chromaFormat );
-          const int chromaScaleY = getComponentScaleY( compID, tmpYuv.chromaFormat );
+      for( int compIdx = 1; compIdx < MAX_NUM_COMPONENT; compIdx++ )
+      {
+        ComponentID compID = ComponentID( compIdx );
+        const int chromaScaleX = getComponentScaleX( compID, tmpYuv.chromaFormat );
+        const int chromaScaleY = getComponentScaleY( compID, tmpYuv.chromaFormat );
 
-          if (m_modes[compIdx][ctuIdx] != AlfMode::OFF)
-          {
-            Area    blk(xPos >> chromaScaleX, yPos >> chromaScaleY, width >> chromaScaleX, height >> chromaScaleY);
-            const int altNum = m_modes[compIdx][ctuIdx] - AlfMode::CHROMA0;
+        if (m_modes[compIdx][ctuIdx] != AlfMode::OFF)
+        {
+          Area    blk(xPos >> chromaScaleX, yPos >> chromaScaleY, width >> chromaScaleX, height >> chromaScaleY);
+          const int altNum = m_modes[compIdx][ctuIdx] - AlfMode::CHROMA0;
 #if GREEN_METADATA_SEI_ENABLED
-            cs.m_featureCounter.alfChromaType5+= ((width >> chromaScaleX) * (height >> chromaScaleY) / 16) ;
-            cs.m_featureCounter.alfChromaPels += ((width >> chromaScaleX) * (height >> chromaScaleY)) ;
+          cs.m_featureCounter.alfChromaType5+= ((width >> chromaScaleX) * (height >> chromaScaleY) / 16) ;
+          cs.m_featureCounter.alfChromaPels += ((width >> chromaScaleX) * (height >> chromaScaleY)) ;
 #endif
-            m_filter5x5Blk(m_classifier, recYuv, tmpYuv, blk, blk, compID, m_chromaCoeffFinal[altNum],
-                           m_chromaClipValsFinal[altNum], m_clpRngs.comp[compIdx], cs, m_alfVBChmaCTUHeight,
-                           m_alfVBChmaPos);
-          }
-          if (cu->slice->m_ccAlfFilterParam.ccAlfFilterEnabled[compIdx - 1])
-          {
-            const int filterIdx = m_ccAlfFilterControl[compIdx - 1][ctuIdx];
+          m_filter5x5Blk(m_classifier, recYuv, tmpYuv, blk, blk, compID, m_chromaCoeffFinal[altNum],
+                         m_chromaClipValsFinal[altNum], m_clpRngs.comp[compIdx], cs, m_alfVBChmaCTUHeight,
+                         m_alfVBChmaPos);
+        }
+        if (cu->slice->m_ccAlfFilterParam.ccAlfFilterEnabled[compIdx - 1])
+        {
+          const int filterIdx = m_ccAlfFilterControl[compIdx - 1][ctuIdx];
 
-            if (filterIdx != 0)
-            {
-              Area blkDst(xPos >> chromaScaleX, yPos >> chromaScaleY, width >> chromaScaleX, height >> chromaScaleY);
-              Area blkSrc(xPos, yPos, width, height);
+          if (filterIdx != 0)
+          {
+            Area blkDst(xPos >> chromaScaleX, yPos >> chromaScaleY, width >> chromaScaleX, height >> chromaScaleY);
+            Area blkSrc(xPos, yPos, width, height);
 
-              const int16_t *filterCoeff = m_ccAlfFilterParam.ccAlfCoeff[compIdx - 1][filterIdx - 1];
+            const int16_t *filterCoeff = m_ccAlfFilterParam.ccAlfCoeff[compIdx - 1][filterIdx - 1];
 #if GREEN_METADATA_SEI_ENABLED
-              cs.m_featureCounter.ccalf++;
+            cs.m_featureCounter.ccalf++;
 #endif
-              m_filterCcAlf(recYuv.get(compID), tmpYuv, blkDst, blkSrc, compID, filterCoeff, m_clpRngs, cs,
-                            m_alfVBLumaCTUHeight, m_alfVBLumaPos);
-            }
+            m_filterCcAlf(recYuv.get(compID), tmpYuv, blkDst, blkSrc, compID, filterCoeff, m_clpRngs, cs,
+                          m_alfVBLumaCTUHeight, m_alfVBLumaPos);
           }
         }
       }
-      ctuIdx++;
     }
+    ctuIdx++;
   }
+  return lastSlice;
 }
 
 void AdaptiveLoopFilter::reconstructCoeffAPSs(CodingStructure& cs, bool luma, bool chroma, bool isRdo)
+{
+  reconstructCoeffAPSs(*cs.slice, luma, chroma, isRdo);
+}
+
+void AdaptiveLoopFilter::reconstructCoeffAPSs(Slice& slice, bool luma, bool chroma, bool isRdo)
 {
   //luma
-  APS** aps = cs.slice->getAlfAPSs();
+  APS** aps = slice.getAlfAPSs();
   AlfParam alfParamTmp;
   APS* curAPS;
   if (luma)
   {
-    for (int i = 0; i < cs.slice->getNumAlfApsIdsLuma(); i++)
+    for (int i = 0; i < slice.getNumAlfApsIdsLuma(); i++)
     {
-      int apsIdx = cs.slice->getAlfApsIdsLuma()[i];
+      int apsIdx = slice.getAlfApsIdsLuma()[i];
       curAPS = aps[apsIdx];
       CHECK(curAPS == nullptr, "invalid APS");
       alfParamTmp = curAPS->getAlfAPSParam();
@@ -615,7 +664,7 @@ void AdaptiveLoopFilter::reconstructCoeffAPSs(CodingStructure& cs, bool luma, bo
   //chroma
   if (chroma)
   {
-    int apsIdxChroma = cs.slice->getAlfApsIdChroma();
+    int apsIdxChroma = slice.getAlfApsIdChroma();
     curAPS = aps[apsIdxChroma];
     m_alfParamChroma = &curAPS->getAlfAPSParam();
     alfParamTmp = *m_alfParamChroma;
@@ -1285,7 +1334,7 @@ void AdaptiveLoopFilter::filterBlkCcAlf(const PelBuf& dstBuf, const CPelUnitBuf&
 
   CHECK(!isChroma(compId), "Must be chroma");
 
-  const SPS*     sps           = cs.slice->getSPS();
+  const SPS*     sps           = cs.sps;
   ChromaFormat nChromaFormat   = sps->getChromaFormatIdc();
   const int clsSizeY           = 4;
   const int clsSizeX           = 4;
@@ -82,8 +82,13 @@ public:
   AdaptiveLoopFilter();
   virtual ~AdaptiveLoopFilter() {}
   void reconstructCoeffAPSs(CodingStructure& cs, bool luma, bool chroma, bool isRdo);
+  void reconstructCoeffAPSs(Slice& slice, bool luma, bool chroma, bool isRdo);
   void reconstructCoeff(AlfParam& alfParam, ChannelType channel, const bool isRdo, const bool isRedo = false);
   void ALFProcess(CodingStructure& cs);
+  /// filters one CTU row, whose SAO output has to be complete, as has the one of the row below. Rows have to be
+  /// processed top to bottom, the active slice of the coding structure is neither used nor changed. Returns the slice
+  /// whose ALF parameters have been loaded last for the row (nullptr if none).
+  Slice* ALFProcessCtuRow(CodingStructure& cs, const int ctuRow);
   void        create(const int picWidth, const int picHeight, const ChromaFormat format, const int maxCUWidth,
                      const int maxCUHeight, const int maxCUDepth, const BitDepths &inputBitDepth);
   void destroy();
@@ -130,6 +135,7 @@ public:
 #endif
 
 protected:
+  Slice* xFilterCtuRow( CodingStructure& cs, const PelUnitBuf& tmpYuv, const int ctuRow );   ///< returns the last slice whose parameters were loaded
   bool isCrossedByVirtualBoundaries( const CodingStructure& cs, const int xPos, const int yPos, const int width, const int height, bool& clipTop, bool& clipBottom, bool& clipLeft, bool& clipRight, int& numHorVirBndry, int& numVerVirBndry, int horVirBndryPos[], int verVirBndryPos[], int& rasterSliceAlfPad );
 
   CcAlfFilterParam       m_ccAlfFilterParam;
@@ -58,15 +58,15 @@ OutputBitstream::~OutputBitstream()
 }
 
 InputBitstream::InputBitstream()
-  : m_fifo(), m_emulationPreventionByteLocation(), m_fifoIdx(0), m_numHeldBits(0), m_heldBits(0), m_numBitsRead(0)
+  : m_fifo(), m_emulationPreventionByteLocation(), m_fifoIdx(0), m_cache(0), m_numCachedBits(0), m_numBitsRead(0)
 { }
 
 InputBitstream::InputBitstream(const InputBitstream &src)
   : m_fifo(src.m_fifo)
   , m_emulationPreventionByteLocation(src.m_emulationPreventionByteLocation)
   , m_fifoIdx(src.m_fifoIdx)
-  , m_numHeldBits(src.m_numHeldBits)
-  , m_heldBits(src.m_heldBits)
+  , m_cache(src.m_cache)
+  , m_numCachedBits(src.m_numCachedBits)
   , m_numBitsRead(src.m_numBitsRead)
 { }
 
@@ -76,10 +76,10 @@ InputBitstream::InputBitstream(const InputBitstream &src)
 
 void InputBitstream::resetToStart()
 {
-  m_fifoIdx     = 0;
-  m_numHeldBits = 0;
-  m_heldBits    = 0;
-  m_numBitsRead = 0;
+  m_fifoIdx       = 0;
+  m_cache         = 0;
+  m_numCachedBits = 0;
+  m_numBitsRead   = 0;
 }
 
 const uint8_t *OutputBitstream::getByteStream() const { return m_fifo.data(); }
@@ -233,17 +233,45 @@ int OutputBitstream::countStartCodeEmulations()
  */
 void InputBitstream::pseudoRead(uint32_t numberOfBits, uint32_t &bits)
 {
-  uint32_t savedNumHeldBits = m_numHeldBits;
-  uint8_t  savedHeldBits    = m_heldBits;
-  uint32_t savedFifoIdx     = m_fifoIdx;
+  uint32_t savedFifoIdx       = m_fifoIdx;
+  uint64_t savedCache         = m_cache;
+  uint32_t savedNumCachedBits = m_numCachedBits;
 
   uint32_t numBitsToRead = std::min(numberOfBits, getNumBitsLeft());
   read(numBitsToRead, bits);
   bits <<= (numberOfBits - numBitsToRead);
 
-  m_fifoIdx     = savedFifoIdx;
-  m_heldBits    = savedHeldBits;
-  m_numHeldBits = savedNumHeldBits;
+  m_fifoIdx       = savedFifoIdx;
+  m_cache         = savedCache;
+  m_numCachedBits = savedNumCachedBits;
+}
+
+/**
+ * load the whole bytes that fit into the unused part of the cache.
+ * Away from the end of the FIFO, this is a single 64-bit load.
+ */
+void InputBitstream::xRefill()
+{
+  const uint32_t numBytes = (BITS_PER_CACHE - m_numCachedBits) >> BITS_PER_BYTE_LOG2;
+
+  if (m_fifoIdx + sizeof(uint64_t) <= m_fifo.size())
+  {
+    // big-endian load, which compilers turn into a load and a byte swap
+    const uint8_t *p    = &m_fifo[m_fifoIdx];
+    uint64_t       word = uint64_t(p[0]) << 56 | uint64_t(p[1]) << 48 | uint64_t(p[2]) << 40 | uint64_t(p[3]) << 32
+                    | uint64_t(p[4]) << 24 | uint64_t(p[5]) << 16 | uint64_t(p[6]) << 8 | uint64_t(p[7]);
+    word &= ~uint64_t(0) << (BITS_PER_CACHE - numBytes * BITS_PER_BYTE);
+    m_cache |= word >> m_numCachedBits;
+    m_fifoIdx += numBytes;
+    m_numCachedBits += numBytes * BITS_PER_BYTE;
+    return;
+  }
+
+  for (uint32_t i = 0; i < numBytes && m_fifoIdx < m_fifo.size(); i++)
+  {
+    m_cache |= uint64_t(m_fifo[m_fifoIdx++]) << (BITS_PER_CACHE - BITS_PER_BYTE - m_numCachedBits);
+    m_numCachedBits += BITS_PER_BYTE;
+  }
 }
 
 void InputBitstream::read(uint32_t numberOfBits, uint32_t &ruiBits)
@@ -252,64 +280,23 @@ void InputBitstream::read(uint32_t numberOfBits, uint32_t &ruiBits)
 
   m_numBitsRead += numberOfBits;
 
-  /* NB, bits are extracted from the MSB of each byte. */
-  uint32_t retval = 0;
-  if (numberOfBits <= m_numHeldBits)
+  if (numberOfBits == 0)
   {
-    /* n=1, len(H)=7:   -VHH HHHH, shift_down=6, mask=0xfe
-     * n=3, len(H)=7:   -VVV HHHH, shift_down=4, mask=0xf8
-     */
-    retval = m_heldBits >> (m_numHeldBits - numberOfBits);
-    retval &= ~(BYTE_MASK << numberOfBits);
-    m_numHeldBits -= numberOfBits;
-    ruiBits = retval;
+    ruiBits = 0;
     return;
   }
 
-  /* all num_held_bits will go into retval
-   *   => need to mask leftover bits from previous extractions
-   *   => align retval with top of extracted word */
-  /* n=5, len(H)=3: ---- -VVV, mask=0x07, shift_up=5-3=2,
-   * n=9, len(H)=3: ---- -VVV, mask=0x07, shift_up=9-3=6 */
-  numberOfBits -= m_numHeldBits;
-  retval = m_heldBits & ~(BYTE_MASK << m_numHeldBits);
-  retval <<= numberOfBits;
-
-  /* number of whole bytes that need to be loaded to form retval */
-  /* n=32, len(H)=0, load 4bytes, shift_down=0
-   * n=32, len(H)=1, load 4bytes, shift_down=1
-   * n=31, len(H)=1, load 4bytes, shift_down=1+1
-   * n=8,  len(H)=0, load 1byte,  shift_down=0
-   * n=8,  len(H)=3, load 1byte,  shift_down=3
-   * n=5,  len(H)=1, load 1byte,  shift_down=1+3
-   */
-  uint32_t alignedWord       = 0;
-  uint32_t num_bytes_to_load = (numberOfBits - 1) >> BITS_PER_BYTE_LOG2;
-  CHECK(m_fifoIdx + num_bytes_to_load >= m_fifo.size(), "Exceeded FIFO size");
-
-  switch (num_bytes_to_load)
+  /* the FIFO is checked only when the cache runs short */
+  if (numberOfBits > m_numCachedBits)
   {
-  case 3:
-    alignedWord = m_fifo[m_fifoIdx++] << 3 * BITS_PER_BYTE;
-  case 2:
-    alignedWord |= m_fifo[m_fifoIdx++] << 2 * BITS_PER_BYTE;
-  case 1:
-    alignedWord |= m_fifo[m_fifoIdx++] << BITS_PER_BYTE;
-  case 0:
-    alignedWord |= m_fifo[m_fifoIdx++];
+    xRefill();
+    CHECK(numberOfBits > m_numCachedBits, "Exceeded FIFO size");
   }
 
-  /* resolve remainder bits */
-  uint32_t nextNumHeldBits = (BITS_PER_WORD - numberOfBits) % BITS_PER_BYTE;
-
-  /* copy required part of alignedWord into retval */
-  retval |= alignedWord >> nextNumHeldBits;
-
-  /* store held bits */
-  m_numHeldBits = nextNumHeldBits;
-  m_heldBits    = alignedWord;
-
-  ruiBits = retval;
+  /* NB, bits are extracted from the MSB of the cache. */
+  ruiBits = uint32_t(m_cache >> (BITS_PER_CACHE - numberOfBits));
+  m_cache <<= numberOfBits;
+  m_numCachedBits -= numberOfBits;
 }
 
 /**
@@ -349,8 +336,13 @@ InputBitstream *InputBitstream::extractSubstream(uint32_t numBits)
   std::vector<uint8_t> &buf = pResult->getFifo();
   buf.reserve((numBits + BITS_PER_BYTE_MASK) >> BITS_PER_BYTE_LOG2);
 
-  if (m_numHeldBits == 0)
+  if (getNumBitsUntilByteAligned() == 0)
   {
+    // the cached bytes are read again from the FIFO
+    m_fifoIdx       = getByteLocation();
+    m_cache         = 0;
+    m_numCachedBits = 0;
+
     const size_t   currentOutputBufferSize = buf.size();
     const uint32_t numBytesToReadFromFifo  = std::min<uint32_t>(numBytes, (uint32_t) m_fifo.size() - m_fifoIdx);
     buf.resize(currentOutputBufferSize + numBytes);
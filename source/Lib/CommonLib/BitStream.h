@@ -53,6 +53,7 @@ static constexpr int      BITS_PER_BYTE      = 1 << BITS_PER_BYTE_LOG2;
 static constexpr int      BITS_PER_BYTE_MASK = BITS_PER_BYTE - 1;
 static constexpr int      BITS_PER_WORD      = BITS_PER_BYTE * sizeof(uint32_t);
 static constexpr uint32_t BYTE_MASK          = (1 << BITS_PER_BYTE) - 1;
+static constexpr int      BITS_PER_CACHE     = BITS_PER_BYTE * sizeof(uint64_t);
 
 // ====================================================================================================================
 // Class definition
@@ -156,12 +157,14 @@ protected:
   std::vector<uint8_t> m_origFifo; /// for calculation of hash
 #endif
 
-  uint32_t m_fifoIdx;   /// Read index into m_fifo
+  uint32_t m_fifoIdx;   /// Read index into m_fifo, of the next byte to be loaded into m_cache
 
-  uint32_t  m_numHeldBits;
-  uint8_t   m_heldBits;
+  uint64_t  m_cache;           /// bits loaded from m_fifo and not read yet, MSB first
+  uint32_t  m_numCachedBits;   /// number of valid bits in m_cache
   uint32_t  m_numBitsRead;
 
+  void      xRefill();
+
 public:
   /**
    * Create a new bitstream reader object that reads from buf.
@@ -177,8 +180,14 @@ public:
   void        read(uint32_t numberOfBits, uint32_t &ruiBits);
   void        readByte        ( uint32_t &ruiBits )
   {
-    CHECK(m_fifoIdx >= m_fifo.size(), "FIFO exceeded");
-    ruiBits = m_fifo[m_fifoIdx++];
+    if (m_numCachedBits < BITS_PER_BYTE)
+    {
+      xRefill();
+      CHECK(m_numCachedBits < BITS_PER_BYTE, "FIFO exceeded");
+    }
+    ruiBits = uint32_t(m_cache >> (BITS_PER_CACHE - BITS_PER_BYTE));
+    m_cache <<= BITS_PER_BYTE;
+    m_numCachedBits -= BITS_PER_BYTE;
 #if ENABLE_TRACING
     m_numBitsRead += 8;
 #endif
@@ -186,14 +195,13 @@ public:
 
   void        peekPreviousByte( uint32_t &byte )
   {
-    CHECK(m_fifoIdx == 0, "FIFO empty");
-    byte = m_fifo[m_fifoIdx - 1];
+    CHECK(getByteLocation() == 0, "FIFO empty");
+    byte = m_fifo[getByteLocation() - 1];
   }
 
   uint32_t        readOutTrailingBits ();
-  uint8_t          getHeldBits() { return m_heldBits; }
   OutputBitstream& operator= (const OutputBitstream& src);
-  uint32_t         getByteLocation() { return m_fifoIdx; }
+  uint32_t         getByteLocation() { return m_fifoIdx - (m_numCachedBits >> BITS_PER_BYTE_LOG2); }
 
   // Peek at bits in word-storage. Used in determining if we have completed reading of current bitstream and therefore slice in LCEC.
   uint32_t peekBits(uint32_t bits)
@@ -206,8 +214,8 @@ public:
   // utility functions
   uint32_t read(uint32_t numberOfBits)      { uint32_t tmp; read(numberOfBits, tmp); return tmp; }
   uint32_t readByte()                   { uint32_t tmp; readByte( tmp ); return tmp; }
-  uint32_t        getNumBitsUntilByteAligned() { return m_numHeldBits & (0x7); }
-  uint32_t        getNumBitsLeft() { return 8 * ((uint32_t) m_fifo.size() - m_fifoIdx) + m_numHeldBits; }
+  uint32_t        getNumBitsUntilByteAligned() { return m_numCachedBits & (0x7); }
+  uint32_t        getNumBitsLeft() { return 8 * ((uint32_t) m_fifo.size() - m_fifoIdx) + m_numCachedBits; }
   InputBitstream *extractSubstream(uint32_t numBits);   // Read the nominated number of bits, and return as a bitstream.
   uint32_t  getNumBitsRead()            { return m_numBitsRead; }
   uint32_t  readByteAlignment();
@@ -109,7 +109,7 @@ struct PelBufferOps
   void (*roundIntVector) (int* v, int size, unsigned int nShift, const int dmvLimit);
 };
 
-extern PelBufferOps g_pelBufOP;
+extern PelBufferOps g_pelBufOP;   ///< kernel table shared by all coder instances, only written by its one-time SIMD initialization
 
 void paddingCore(Pel *ptr, ptrdiff_t stride, int width, int height, int padSize);
 void copyBufferCore(const Pel *src, ptrdiff_t srcStride, Pel *Dst, ptrdiff_t dstStride, int width, int height);
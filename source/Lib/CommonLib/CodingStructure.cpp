@@ -43,7 +43,7 @@
 #include "UnitTools.h"
 #include "UnitPartitioner.h"
 
-XuPool g_xuPool = XuPool();
+#include <atomic>
 
 // ---------------------------------------------------------------------------
 // coding structure method definitions
@@ -732,12 +732,13 @@ CodingUnit* CodingStructure::getCU( const Position &pos, const ChannelType effCh
 {
   const CompArea &_blk = area.block(effChType);
 
-  if (!_blk.contains(pos) || (treeType == TREE_C && isLuma(effChType)))
+  // only sub-structures redirect luma look-ups of a chroma tree, the tree type of the picture level structure is
+  // parser state and may change while already parsed CTUs are being reconstructed
+  if (!_blk.contains(pos) || (parent && treeType == TREE_C && isLuma(effChType)))
   {
     //keep this check, which is helpful to identify bugs
-    if (treeType == TREE_C && isLuma(effChType))
+    if (parent && treeType == TREE_C && isLuma(effChType))
     {
-      CHECK( parent == nullptr, "parent shall be valid; consider using function getLumaCU()" );
       CHECK( parent->treeType != TREE_D, "wrong parent treeType " );
     }
     if (parent)
@@ -769,11 +770,10 @@ const CodingUnit* CodingStructure::getCU( const Position &pos, const ChannelType
 {
   const CompArea &_blk = area.block(effChType);
 
-  if (!_blk.contains(pos) || (treeType == TREE_C && isLuma(effChType)))
+  if (!_blk.contains(pos) || (parent && treeType == TREE_C && isLuma(effChType)))
   {
-    if (treeType == TREE_C && isLuma(effChType))
+    if (parent && treeType == TREE_C && isLuma(effChType))
     {
-      CHECK( parent == nullptr, "parent shall be valid; consider using function getLumaCU()" );
       CHECK( parent->treeType != TREE_D, "wrong parent treeType" );
     }
     if (parent)
@@ -998,6 +998,8 @@ CodingUnit& CodingStructure::addCU( const UnitArea &unit, const ChannelType chTy
 
   if( prevCU )
   {
+    // threads traversing the CUs of an earlier CTU may follow the link, so publish the area first
+    std::atomic_thread_fence(std::memory_order_release);
     prevCU->next = cu;
   }
 
@@ -1006,6 +1008,9 @@ CodingUnit& CodingStructure::addCU( const UnitArea &unit, const ChannelType chTy
   uint32_t idx = ++m_numCUs;
   cu->idx  = idx;
 
+  // make the unit visible before its index, which threads reconstructing earlier CTUs may already look up
+  std::atomic_thread_fence(std::memory_order_release);
+
   for (auto chType = ChannelType::LUMA; chType <= ::getLastChannel(area.chromaFormat); chType++)
   {
     if (!cu->block(chType).valid())
@@ -1056,6 +1061,9 @@ PredictionUnit& CodingStructure::addPU( const UnitArea &unit, const ChannelType
   uint32_t idx = ++m_numPUs;
   pu->idx  = idx;
 
+  // make the unit visible before its index, which threads reconstructing earlier CTUs may already look up
+  std::atomic_thread_fence(std::memory_order_release);
+
   for (auto chType = ChannelType::LUMA; chType <= ::getLastChannel(area.chromaFormat); chType++)
   {
     if (!pu->block(chType).valid())
@@ -1111,6 +1119,9 @@ TransformUnit& CodingStructure::addTU( const UnitArea &unit, const ChannelType c
   uint32_t idx = ++m_numTUs;
   tu->idx  = idx;
 
+  // make the unit visible before its index, which threads reconstructing earlier CTUs may already look up
+  std::atomic_thread_fence(std::memory_order_release);
+
   TCoeff *coeffs[5] = { nullptr, nullptr, nullptr, nullptr, nullptr };
   Pel    *pltIdxBuf[5] = { nullptr, nullptr, nullptr, nullptr, nullptr };
   EnumArray<PLTRunMode*, ChannelType> runType;
@@ -1210,10 +1221,15 @@ void CodingStructure::addEmptyTUs( Partitioner &partitioner )
 }
 
 CUTraverser CodingStructure::traverseCUs( const UnitArea& unit, const ChannelType effChType )
+{
+  return traverseCUs( unit, effChType, CS::isDualITree( *this ) );
+}
+
+CUTraverser CodingStructure::traverseCUs( const UnitArea& unit, const ChannelType effChType, const bool isDualITree )
 {
   CodingUnit* firstCU = getCU( isLuma( effChType ) ? unit.lumaPos() : unit.chromaPos(), effChType );
   CodingUnit* lastCU = firstCU;
-  if( !CS::isDualITree( *this ) ) //for a more generalized separate tree
+  if( !isDualITree ) //for a more generalized separate tree
   {
     bool bContinue = true;
     CodingUnit* currCU = firstCU;
@@ -1618,7 +1634,7 @@ void CodingStructure::initSubStructure( CodingStructure& subStruct, const Channe
 
   subStruct.m_isTuEnc = isTuEnc;
 
-  subStruct.motionLut = motionLut;
+  subStruct.motionLut = isLuma(_chType) ? getMotionLut(subArea.lumaPos()) : motionLut;
 
   subStruct.prevPLT = prevPLT;
 
@@ -1706,7 +1722,7 @@ void CodingStructure::useSubStructure( const CodingStructure& subStruct, const C
 
     ownMB.copyFrom( subMB );
 
-    motionLut = subStruct.motionLut;
+    getMotionLut(clippedArea.lumaPos()) = subStruct.motionLut;
   }
   prevPLT = subStruct.prevPLT;
 
@@ -2059,7 +2075,7 @@ PelBuf CodingStructure::getBuf( const CompArea &blk, const PictureType &type )
   cFinal.relativeTo( area.blocks[compID] );
 
 #if !KEEP_PRED_AND_RESI_SIGNALS
-  if( !parent && ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) )
+  if( !parent && ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) && ( !picture || picture->isCtuSizedPredResi() ) )
   {
     cFinal.x &= ( pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
     cFinal.y &= ( pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
@@ -2093,7 +2109,7 @@ const CPelBuf CodingStructure::getBuf( const CompArea &blk, const PictureType &t
   cFinal.relativeTo( area.blocks[compID] );
 
 #if !KEEP_PRED_AND_RESI_SIGNALS
-  if( !parent && ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) )
+  if( !parent && ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) && ( !picture || picture->isCtuSizedPredResi() ) )
   {
     cFinal.x &= ( pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
     cFinal.y &= ( pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
@@ -2129,17 +2145,33 @@ const CPelUnitBuf CodingStructure::getBuf( const UnitArea &unit, const PictureTy
   }
 }
 
+bool CodingStructure::isInPicAndTile( const Position &pos, const Position &curPos, const ChannelType _chType ) const
+{
+  // checked on the positions, before any unit is looked up, as the units of other tiles may be coded concurrently
+  const int scaleX = 1 << getChannelTypeScaleX( _chType, area.chromaFormat );
+  const int scaleY = 1 << getChannelTypeScaleY( _chType, area.chromaFormat );
+  const int x      = pos.x * scaleX;
+  const int y      = pos.y * scaleY;
+  return x >= 0 && y >= 0 && x < (int) pcv->lumaWidth && y < (int) pcv->lumaHeight
+         && pps->getTileIdx( Position( x, y ) ) == pps->getTileIdx( Position( curPos.x * scaleX, curPos.y * scaleY ) );
+}
+
 const CodingUnit* CodingStructure::getCURestricted( const Position &pos, const CodingUnit& curCu, const ChannelType _chType ) const
 {
+  if( !isInPicAndTile( pos, curCu.block( _chType ).pos(), _chType ) )
+  {
+    return nullptr;
+  }
   const CodingUnit* cu = getCU( pos, _chType );
-  // exists       same slice and tile                  cu precedes curCu in encoding order
-  //                                                  (thus, is either from parent CS in RD-search or its index is lower)
+  // exists       cu precedes curCu in encoding order  same slice and tile
+  //              (thus, is either from parent CS in RD-search or its index is lower; checked first, as the slice of a
+  //              unit parsed after curCu may not be set yet when CTUs are reconstructed in parallel)
   const bool wavefrontsEnabled = curCu.slice->getSPS()->getEntropyCodingSyncEnabledFlag();
   int ctuSizeBit = floorLog2(curCu.cs->sps->getMaxCUWidth());
   int xNbY  = pos.x << getChannelTypeScaleX( _chType, curCu.chromaFormat );
   int        xCurr             = curCu.block(_chType).x << getChannelTypeScaleX(_chType, curCu.chromaFormat);
   bool addCheck = (wavefrontsEnabled && (xNbY >> ctuSizeBit) >= (xCurr >> ctuSizeBit) + 1 ) ? false : true;
-  if( cu && CU::isSameSliceAndTile( *cu, curCu ) && ( cu->cs != curCu.cs || cu->idx <= curCu.idx ) && addCheck)
+  if( cu && ( cu->cs != curCu.cs || cu->idx <= curCu.idx ) && CU::isSameSliceAndTile( *cu, curCu ) && addCheck)
   {
     return cu;
   }
@@ -2151,6 +2183,10 @@ const CodingUnit* CodingStructure::getCURestricted( const Position &pos, const C
 
 const CodingUnit* CodingStructure::getCURestricted( const Position &pos, const Position curPos, const unsigned curSliceIdx, const TileIdx curTileIdx, const ChannelType _chType ) const
 {
+  if( !isInPicAndTile( pos, curPos, _chType ) )
+  {
+    return nullptr;
+  }
   const CodingUnit* cu = getCU( pos, _chType );
   const bool wavefrontsEnabled = this->slice->getSPS()->getEntropyCodingSyncEnabledFlag();
   int ctuSizeBit = floorLog2(this->sps->getMaxCUWidth());
@@ -2164,6 +2200,10 @@ const CodingUnit* CodingStructure::getCURestricted( const Position &pos, const P
 
 const PredictionUnit* CodingStructure::getPURestricted( const Position &pos, const PredictionUnit& curPu, const ChannelType _chType ) const
 {
+  if( !isInPicAndTile( pos, curPu.block( _chType ).pos(), _chType ) )
+  {
+    return nullptr;
+  }
   const PredictionUnit* pu = getPU( pos, _chType );
   // exists       same slice and tile                  pu precedes curPu in encoding order
   //                                                  (thus, is either from parent CS in RD-search or its index is lower)
@@ -2172,7 +2212,7 @@ const PredictionUnit* CodingStructure::getPURestricted( const Position &pos, con
   int xNbY  = pos.x << getChannelTypeScaleX( _chType, curPu.chromaFormat );
   int        xCurr             = curPu.block(_chType).x << getChannelTypeScaleX(_chType, curPu.chromaFormat);
   bool addCheck = (wavefrontsEnabled && (xNbY >> ctuSizeBit) >= (xCurr >> ctuSizeBit) + 1 ) ? false : true;
-  if( pu && CU::isSameSliceAndTile( *pu->cu, *curPu.cu ) && ( pu->cs != curPu.cs || pu->idx <= curPu.idx ) && addCheck )
+  if( pu && ( pu->cs != curPu.cs || pu->idx <= curPu.idx ) && CU::isSameSliceAndTile( *pu->cu, *curPu.cu ) && addCheck )
   {
     return pu;
   }
@@ -2184,6 +2224,10 @@ const PredictionUnit* CodingStructure::getPURestricted( const Position &pos, con
 
 const TransformUnit* CodingStructure::getTURestricted( const Position &pos, const TransformUnit& curTu, const ChannelType _chType ) const
 {
+  if( !isInPicAndTile( pos, curTu.block( _chType ).pos(), _chType ) )
+  {
+    return nullptr;
+  }
   const TransformUnit* tu = getTU( pos, _chType );
   // exists       same slice and tile                  tu precedes curTu in encoding order
   //                                                  (thus, is either from parent CS in RD-search or its index is lower)
@@ -2192,7 +2236,7 @@ const TransformUnit* CodingStructure::getTURestricted( const Position &pos, cons
   int xNbY  = pos.x << getChannelTypeScaleX( _chType, curTu.chromaFormat );
   int        xCurr             = curTu.block(_chType).x << getChannelTypeScaleX(_chType, curTu.chromaFormat);
   bool addCheck = (wavefrontsEnabled && (xNbY >> ctuSizeBit) >= (xCurr >> ctuSizeBit) + 1 ) ? false : true;
-  if( tu && CU::isSameSliceAndTile( *tu->cu, *curTu.cu ) && ( tu->cs != curTu.cs || tu->idx <= curTu.idx ) && addCheck )
+  if( tu && ( tu->cs != curTu.cs || tu->idx <= curTu.idx ) && CU::isSameSliceAndTile( *tu->cu, *curTu.cu ) && addCheck )
   {
     return tu;
   }
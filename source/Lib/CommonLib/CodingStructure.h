@@ -66,7 +66,6 @@ enum PictureType
   PIC_YUV_POST_REC,
   NUM_PIC_TYPES
 };
-extern XuPool g_xuPool;
 
 // ---------------------------------------------------------------------------
 // coding structure
@@ -175,6 +174,8 @@ public:
   void            addEmptyTUs(Partitioner &partitioner);
 
   CUTraverser     traverseCUs(const UnitArea& _unit, const ChannelType _chType);
+  /// as above, with the dual tree mode given by the caller instead of being derived from the active slice
+  CUTraverser     traverseCUs(const UnitArea& _unit, const ChannelType _chType, const bool isDualITree);
   PUTraverser     traversePUs(const UnitArea& _unit, const ChannelType _chType);
   TUTraverser     traverseTUs(const UnitArea& _unit, const ChannelType _chType);
 
@@ -225,6 +226,7 @@ private:
   void createCoeffs(const bool isPLTused);
   void destroyCoeffs();
   void createInternals(const UnitArea& _unit, const bool isTopLayer, const bool isPLTused);
+  bool isInPicAndTile(const Position &pos, const Position &curPos, const ChannelType _chType) const;
 
 public:
 
@@ -233,6 +235,19 @@ public:
   std::vector< TransformUnit*> tus;
 
   LutMotionCand motionLut;
+  // HMVP tables of the picture level structure kept per CTU when CTUs are reconstructed in parallel (empty otherwise)
+  std::vector<LutMotionCand> ctuMotionLut;
+
+  LutMotionCand &getMotionLut(const Position &pos)
+  {
+    return ctuMotionLut.empty() ? motionLut
+                                : ctuMotionLut[(pos.y >> pcv->maxCUHeightLog2) * pcv->widthInCtus + (pos.x >> pcv->maxCUWidthLog2)];
+  }
+  const LutMotionCand &getMotionLut(const Position &pos) const
+  {
+    return ctuMotionLut.empty() ? motionLut
+                                : ctuMotionLut[(pos.y >> pcv->maxCUHeightLog2) * pcv->widthInCtus + (pos.x >> pcv->maxCUWidthLog2)];
+  }
 
   void addMiToLut(static_vector<MotionInfo, MAX_NUM_HMVP_CANDS>& lut, const MotionInfo &mi);
 
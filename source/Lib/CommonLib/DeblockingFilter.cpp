@@ -152,108 +152,79 @@ void DeblockingFilter::deblockingFilterPic(CodingStructure &cs)
     }
   }
 #endif
-#if GREEN_METADATA_SEI_ENABLED
-  FeatureCounterStruct tempFeatureCounter;
-#endif
+  for( int y = 0; y < pcv.heightInCtus; y++ )
+  {
+    xDeblockCtuRow( cs, EdgeDir::VER, y );
+  }
 
+  // Vertical filtering
   for( int y = 0; y < pcv.heightInCtus; y++ )
   {
-    for( int x = 0; x < pcv.widthInCtus; x++ )
-    {
-      resetBsAndEdgeFilter(EdgeDir::VER);
-      clearFilterLengthAndTransformEdge();
-      m_ctuXLumaSamples = x << pcv.maxCUWidthLog2;
-      m_ctuYLumaSamples = y << pcv.maxCUHeightLog2;
+    xDeblockCtuRow( cs, EdgeDir::HOR, y );
+  }
 
-      const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, y << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUWidth ) );
-      CodingUnit *firstCU = cs.getCU(ctuArea.lumaPos(), ChannelType::LUMA);
-      cs.slice = firstCU->slice;
+  // leave the slice of the last CTU active, as when activating the slice of each CTU while filtering
+  cs.slice = cs.getCU( Position( ( pcv.widthInCtus - 1 ) << pcv.maxCUWidthLog2, ( pcv.heightInCtus - 1 ) << pcv.maxCUHeightLog2 ), ChannelType::LUMA )->slice;
 
-      // CU-based deblocking
-      for (auto &currCU: cs.traverseCUs(CS::getArea(cs, ctuArea, ChannelType::LUMA), ChannelType::LUMA))
-      {
-#if GREEN_METADATA_SEI_ENABLED
-        currCU.m_featureCounter.resetBoundaryStrengths();
-#endif
-        deblockCu(currCU, EdgeDir::VER);
-#if GREEN_METADATA_SEI_ENABLED
-        tempFeatureCounter.addBoundaryStrengths(currCU.m_featureCounter);
-#endif
-      }
+  DTRACE_PIC_COMP(D_REC_CB_LUMA_LF,   cs, cs.getRecoBuf(), COMPONENT_Y);
+  DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cb);
+  DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cr);
 
-      if( CS::isDualITree( cs ) )
-      {
-        resetBsAndEdgeFilter(EdgeDir::VER);
-        clearFilterLengthAndTransformEdge();
+  DTRACE    ( g_trace_ctx, D_CRC, "DeblockingFilter" );
+  DTRACE_CRC( g_trace_ctx, D_CRC, cs, cs.getRecoBuf() );
+}
 
-        for (auto &currCU: cs.traverseCUs(CS::getArea(cs, ctuArea, ChannelType::CHROMA), ChannelType::CHROMA))
-        {
+void DeblockingFilter::deblockingFilterCtuRow( CodingStructure& cs, const int ctuRow )
+{
+  xDeblockCtuRow( cs, EdgeDir::VER, ctuRow );
+  xDeblockCtuRow( cs, EdgeDir::HOR, ctuRow );
+}
+
+void DeblockingFilter::xDeblockCtuRow( CodingStructure& cs, const EdgeDir edgeDir, const int ctuRow )
+{
+  const PreCalcValues &pcv = *cs.pcv;
+  const int            y   = ctuRow;
+
+  for( int x = 0; x < pcv.widthInCtus; x++ )
+  {
+    resetBsAndEdgeFilter(edgeDir);
+    clearFilterLengthAndTransformEdge();
+    m_ctuXLumaSamples = x << pcv.maxCUWidthLog2;
+    m_ctuYLumaSamples = y << pcv.maxCUHeightLog2;
+
+    const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, y << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUWidth ) );
+    const CodingUnit *firstCU = cs.getCU(ctuArea.lumaPos(), ChannelType::LUMA);
+    const bool isDualITree = firstCU->slice->isIntra() && !pcv.ISingleTree;
+
+    // CU-based deblocking
+    for (auto &currCU: cs.traverseCUs(isDualITree ? ctuArea.singleChan(ChannelType::LUMA) : ctuArea, ChannelType::LUMA, isDualITree))
+    {
 #if GREEN_METADATA_SEI_ENABLED
-          currCU.m_featureCounter.resetBoundaryStrengths();
+      currCU.m_featureCounter.resetBoundaryStrengths();
 #endif
-          deblockCu(currCU, EdgeDir::VER);
+      deblockCu(currCU, edgeDir);
 #if GREEN_METADATA_SEI_ENABLED
-          tempFeatureCounter.addBoundaryStrengths(currCU.m_featureCounter);
+      cs.m_featureCounter.addBoundaryStrengths(currCU.m_featureCounter);
 #endif
-        }
-      }
     }
-  }
 
-  // Vertical filtering
-  for( int y = 0; y < pcv.heightInCtus; y++ )
-  {
-    for( int x = 0; x < pcv.widthInCtus; x++ )
+    if( isDualITree )
     {
-      resetBsAndEdgeFilter(EdgeDir::HOR);
+      resetBsAndEdgeFilter(edgeDir);
       clearFilterLengthAndTransformEdge();
-      m_ctuXLumaSamples = x << pcv.maxCUWidthLog2;
-      m_ctuYLumaSamples = y << pcv.maxCUHeightLog2;
-
-      const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, y << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUWidth ) );
-      CodingUnit *firstCU = cs.getCU(ctuArea.lumaPos(), ChannelType::LUMA);
-      cs.slice = firstCU->slice;
 
-      // CU-based deblocking
-      for (auto &currCU: cs.traverseCUs(CS::getArea(cs, ctuArea, ChannelType::LUMA), ChannelType::LUMA))
+      for (auto &currCU: cs.traverseCUs(ctuArea.singleChan(ChannelType::CHROMA), ChannelType::CHROMA, isDualITree))
       {
 #if GREEN_METADATA_SEI_ENABLED
         currCU.m_featureCounter.resetBoundaryStrengths();
 #endif
-        deblockCu(currCU, EdgeDir::HOR);
-#if GREEN_METADATA_SEI_ENABLED
-        tempFeatureCounter.addBoundaryStrengths(currCU.m_featureCounter);
-#endif
-      }
-
-      if( CS::isDualITree( cs ) )
-      {
-        resetBsAndEdgeFilter(EdgeDir::HOR);
-        clearFilterLengthAndTransformEdge();
-
-        for (auto &currCU: cs.traverseCUs(CS::getArea(cs, ctuArea, ChannelType::CHROMA), ChannelType::CHROMA))
-        {
-#if GREEN_METADATA_SEI_ENABLED
-          currCU.m_featureCounter.resetBoundaryStrengths();
-#endif
-          deblockCu(currCU, EdgeDir::HOR);
+        deblockCu(currCU, edgeDir);
 #if GREEN_METADATA_SEI_ENABLED
-          tempFeatureCounter.addBoundaryStrengths(currCU.m_featureCounter);
+        cs.m_featureCounter.addBoundaryStrengths(currCU.m_featureCounter);
 #endif
-        }
       }
     }
   }
-
-#if GREEN_METADATA_SEI_ENABLED
-  cs.m_featureCounter.addBoundaryStrengths(tempFeatureCounter);
-#endif
-  DTRACE_PIC_COMP(D_REC_CB_LUMA_LF,   cs, cs.getRecoBuf(), COMPONENT_Y);
-  DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cb);
-  DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cr);
-
-  DTRACE    ( g_trace_ctx, D_CRC, "DeblockingFilter" );
-  DTRACE_CRC( g_trace_ctx, D_CRC, cs, cs.getRecoBuf() );
 }
 
 void DeblockingFilter::resetBsAndEdgeFilter(const EdgeDir edgeDir)
@@ -991,7 +962,7 @@ void DeblockingFilter::xEdgeFilterLuma(const CodingUnit &cu, const EdgeDir edgeD
   const Slice   &slice    = *(cu.slice);
   const bool     spsPaletteEnabledFlag          = sps->getPLTMode();
   const int      bitDepthLuma                   = sps->getBitDepth(ChannelType::LUMA);
-  const ClpRng& clpRng( cu.cs->slice->clpRng(COMPONENT_Y) );
+  const ClpRng& clpRng( cu.slice->clpRng(COMPONENT_Y) );
 
   int      qp       = 0;
   unsigned     numParts = edgeDir == EdgeDir::VER ? lumaArea.height / pcv.minCUHeight : lumaArea.width / pcv.minCUWidth;
@@ -1314,7 +1285,7 @@ void DeblockingFilter::xEdgeFilterChroma(const CodingUnit &cu, const EdgeDir edg
         {
           auto compId = ComponentID(getFirstComponentOfChannel(ChannelType::CHROMA) + chromaIdx);
 
-          const ClpRng &clpRng(cu.cs->slice->clpRng(compId));
+          const ClpRng &clpRng(cu.slice->clpRng(compId));
 
           Pel *tmpSrcChroma = (chromaIdx == 0) ? tmpSrcCb : tmpSrcCr;
 
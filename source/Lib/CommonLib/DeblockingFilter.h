@@ -152,6 +152,8 @@ private:
 
   void clearFilterLengthAndTransformEdge();
 
+  void xDeblockCtuRow                   ( CodingStructure& cs, const EdgeDir edgeDir, const int ctuRow );
+
   // set / get functions
   void xSetDeblockingFilterParam        ( const CodingUnit& cu );
 
@@ -209,6 +211,10 @@ public:
 
   /// picture-level deblocking filter
   void deblockingFilterPic        ( CodingStructure& cs );
+  /// deblocks the vertical and then the horizontal edges of one CTU row, which modifies the bottom lines of the row
+  /// above. Rows have to be filtered top to bottom once the row below is reconstructed. The active slice of the coding
+  /// structure is neither used nor changed, so the picture may still be parsed meanwhile.
+  void deblockingFilterCtuRow     ( CodingStructure& cs, const int ctuRow );
 
   static int getBeta              ( const int qp )
   {
@@ -51,6 +51,9 @@ Picture::Picture()
   cs                   = nullptr;
   m_isSubPicBorderSaved = false;
   m_extendedBorder        = false;
+#if !KEEP_PRED_AND_RESI_SIGNALS
+  m_ctuSizedPredResi      = true;
+#endif
   m_wrapAroundValid    = false;
   m_wrapAroundOffset   = 0;
   usedByCurr           = false;
@@ -75,6 +78,10 @@ Picture::Picture()
   unscaledPic = nullptr;
   m_grainCharacteristic = nullptr;
   m_grainBuf            = nullptr;
+  m_progressCtuHeight   = 1;
+  m_numCtuRowsDone      = std::numeric_limits<int>::max();
+  m_motionFieldDone     = true;
+  m_decodingFinished    = true;
 }
 
 void Picture::create(const bool useWrapAround, const ChromaFormat& _chromaFormat, const Size& size,
@@ -148,12 +155,14 @@ void Picture::destroy()
   m_grainBuf           = nullptr;
 }
 
-void Picture::createTempBuffers( const unsigned _maxCUSize, bool useFilterFrame, bool resChange, bool decoder, bool isFgFiltered)
+void Picture::createTempBuffers( const unsigned _maxCUSize, bool useFilterFrame, bool resChange, bool decoder, bool isFgFiltered, bool ctuSizedPredResi )
 {
 #if KEEP_PRED_AND_RESI_SIGNALS
   const Area a( Position{ 0, 0 }, lumaSize() );
 #else
-  const Area a = m_ctuArea.Y();
+  // CTUs reconstructed concurrently need disjoint prediction and residual buffers
+  m_ctuSizedPredResi = ctuSizedPredResi;
+  const Area a = ctuSizedPredResi ? m_ctuArea.Y() : Area( Position{ 0, 0 }, lumaSize() );
 #endif
 
   M_BUFS( jId, PIC_PREDICTION                   ).create( chromaFormat, a,   _maxCUSize );
@@ -264,7 +273,7 @@ void Picture::finalInit( const VPS* vps, const SPS& sps, const PPS& pps, PicHead
 
   if (cs == nullptr)
   {
-    cs      = new CodingStructure(g_xuPool);
+    cs      = new CodingStructure(m_unitPool);
     cs->create(chromaFormatIdc, Area(0, 0, width, height), true, (bool) sps.getPLTMode());
   }
 
@@ -1125,6 +1134,78 @@ void Picture::restoreSubPicBorder(int POC, int subPicX0, int subPicY0, int subPi
   m_bufWrapSubPicBelow.destroy();
 }
 
+void Picture::resetDecodingProgress( const int ctuHeight )
+{
+  std::lock_guard<std::mutex> lock( m_progressMutex );
+  m_progressCtuHeight = ctuHeight;
+  m_numCtuRowsDone.store( 0, std::memory_order_relaxed );
+  m_motionFieldDone.store( false, std::memory_order_relaxed );
+  m_decodingFinished.store( false, std::memory_order_relaxed );
+}
+
+void Picture::setMotionFieldDone()
+{
+  {
+    std::lock_guard<std::mutex> lock( m_progressMutex );
+    m_motionFieldDone.store( true, std::memory_order_release );
+  }
+  m_progressCond.notify_all();
+}
+
+void Picture::setCtuRowsDone( const int numRows )
+{
+  {
+    std::lock_guard<std::mutex> lock( m_progressMutex );
+    if( numRows > m_numCtuRowsDone.load( std::memory_order_relaxed ) )
+    {
+      m_numCtuRowsDone.store( numRows, std::memory_order_release );
+    }
+  }
+  m_progressCond.notify_all();
+}
+
+void Picture::setDecodingFinished()
+{
+  {
+    std::lock_guard<std::mutex> lock( m_progressMutex );
+    m_motionFieldDone.store( true, std::memory_order_release );
+    m_numCtuRowsDone.store( std::numeric_limits<int>::max(), std::memory_order_release );
+    m_decodingFinished.store( true, std::memory_order_release );
+  }
+  m_progressCond.notify_all();
+}
+
+void Picture::waitForMotionField() const
+{
+  if( m_motionFieldDone.load( std::memory_order_acquire ) )
+  {
+    return;
+  }
+  std::unique_lock<std::mutex> lock( m_progressMutex );
+  m_progressCond.wait( lock, [this] { return m_motionFieldDone.load( std::memory_order_acquire ); } );
+}
+
+void Picture::waitForLumaRow( const int y ) const
+{
+  const int ctuRow = std::max( y, 0 ) / m_progressCtuHeight;
+  if( m_numCtuRowsDone.load( std::memory_order_acquire ) > ctuRow )
+  {
+    return;
+  }
+  std::unique_lock<std::mutex> lock( m_progressMutex );
+  m_progressCond.wait( lock, [this, ctuRow] { return m_numCtuRowsDone.load( std::memory_order_acquire ) > ctuRow; } );
+}
+
+void Picture::waitForDecodingFinished() const
+{
+  if( m_decodingFinished.load( std::memory_order_acquire ) )
+  {
+    return;
+  }
+  std::unique_lock<std::mutex> lock( m_progressMutex );
+  m_progressCond.wait( lock, [this] { return m_decodingFinished.load( std::memory_order_acquire ); } );
+}
+
 void Picture::extendPicBorder( const SPS *sps, const PPS *pps )
 {
   if (m_extendedBorder)
@@ -1249,7 +1330,7 @@ PelBuf Picture::getBuf( const CompArea &blk, const PictureType &type )
   }
 
 #if !KEEP_PRED_AND_RESI_SIGNALS
-  if( type == PIC_RESIDUAL || type == PIC_PREDICTION )
+  if( ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) && m_ctuSizedPredResi )
   {
     CompArea localBlk = blk;
     localBlk.x &= ( cs->pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
@@ -1270,7 +1351,7 @@ const CPelBuf Picture::getBuf( const CompArea &blk, const PictureType &type ) co
   }
 
 #if !KEEP_PRED_AND_RESI_SIGNALS
-  if( type == PIC_RESIDUAL || type == PIC_PREDICTION )
+  if( ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) && m_ctuSizedPredResi )
   {
     CompArea localBlk = blk;
     localBlk.x &= ( cs->pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
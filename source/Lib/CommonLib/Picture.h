@@ -50,6 +50,10 @@
 #include "MCTS.h"
 #include "SEIColourTransform.h"
 #include <deque>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
 #include "SEIFilmGrainSynthesizer.h"
 
 class SEI;
@@ -76,7 +80,7 @@ struct Picture : public UnitArea
               const unsigned margin, const bool bDecoder, const int layerId, const bool enablePostFilteringForHFR);
   void destroy();
 
-  void createTempBuffers( const unsigned _maxCUSize, bool useFilterFrame, bool resChange, bool decoder, bool isFgFiltered);
+  void createTempBuffers( const unsigned _maxCUSize, bool useFilterFrame, bool resChange, bool decoder, bool isFgFiltered, bool ctuSizedPredResi = true );
   void destroyTempBuffers();
 
   int                       m_padValue;
@@ -151,6 +155,16 @@ struct Picture : public UnitArea
   void extendWrapBorder( const PPS *pps );
   void finalInit( const VPS* vps, const SPS& sps, const PPS& pps, PicHeader *picHeader, APS** alfApss, APS* lmcsAps, APS* scalingListAps );
 
+  // decoding progress, used by frame-parallel decoding to synchronize with pictures still being decoded
+  void resetDecodingProgress( const int ctuHeight );
+  void setMotionFieldDone();
+  void setCtuRowsDone( const int numRows );
+  void setDecodingFinished();
+  bool isDecodingFinished()                   const { return m_decodingFinished.load( std::memory_order_acquire ); }
+  void waitForMotionField() const;
+  void waitForLumaRow( const int y ) const;
+  void waitForDecodingFinished() const;
+
   int  getPOC()                               const { return poc; }
   int  getDecodingOrderNumber()               const { return m_decodingOrderNumber; }
   void setDecodingOrderNumber(const int val)        { m_decodingOrderNumber = val;  }
@@ -193,6 +207,13 @@ private:
   Window        m_scalingWindow;
   int           m_decodingOrderNumber;
   NalUnitType   m_pictureType;
+
+  int                             m_progressCtuHeight;   ///< CTU height used to map luma rows to CTU rows
+  std::atomic<int>                m_numCtuRowsDone;      ///< number of CTU rows with final (filtered) samples
+  std::atomic<bool>               m_motionFieldDone;     ///< motion field is final (usable for TMVP)
+  std::atomic<bool>               m_decodingFinished;    ///< all samples are final and the borders are extended
+  mutable std::mutex              m_progressMutex;
+  mutable std::condition_variable m_progressCond;
 #if GREEN_METADATA_SEI_ENABLED
   FeatureCounterStruct m_featureCounter;
 #endif
@@ -228,6 +249,7 @@ public:
   bool topField;
   bool fieldPic;
   EnumArray<int, ChannelType> m_prevQP;
+  std::shared_mutex unitStorageMutex;   ///< held exclusively while units are added to cs by concurrent CTU parsing or encoding, shared by in-loop filtering running concurrently with the parsing
   bool precedingDRAP; // preceding a DRAP picture in decoding order
   int  edrapRapId;
   bool nonReferencePictureFlag;
@@ -257,6 +279,7 @@ public:
   const Hash        *getHashMap() const { return &m_hashMap; }
   void               addPictureToHashMapForInter();
 
+  XuPool             m_unitPool;   ///< storage of the units of cs, owned by the picture so that pictures are coded independently
   CodingStructure*   cs;
 #if GDR_ENABLED
   GdrPicParam        gdrParam;
@@ -293,8 +316,10 @@ public:
   BitDepths    m_bitDepths;
 
 #if !KEEP_PRED_AND_RESI_SIGNALS
+  bool     isCtuSizedPredResi() const { return m_ctuSizedPredResi; }
 private:
   UnitArea m_ctuArea;
+  bool     m_ctuSizedPredResi;   ///< prediction and residual buffers hold a single CTU (not used with parallel reconstruction)
 #endif
 
   std::vector<AlfMode> m_alfModes[MAX_NUM_COMPONENT];
@@ -214,7 +214,7 @@ int8_t getBcwWeight(uint8_t bcwIdx, uint8_t refFrameList)
   return (refFrameList == REF_PIC_LIST_0 ? BCW_WEIGHT_BASE - g_BcwWeights[bcwIdx] : g_BcwWeights[bcwIdx]);
 }
 
-void resetBcwCodingOrder(bool runDecoding, const CodingStructure &cs)
+static void initBcwCodingOrder()
 {
   // Form parsing order: { BCW_DEFAULT, BCW_DEFAULT+1, BCW_DEFAULT-1, BCW_DEFAULT+2, BCW_DEFAULT-2, ... }
   g_BcwParsingOrder[0] = BCW_DEFAULT;
@@ -225,12 +225,9 @@ void resetBcwCodingOrder(bool runDecoding, const CodingStructure &cs)
   }
 
   // Form encoding order
-  if (!runDecoding)
+  for (int i = 0; i < BCW_NUM; ++i)
   {
-    for (int i = 0; i < BCW_NUM; ++i)
-    {
-      g_BcwCodingOrder[(uint32_t)g_BcwParsingOrder[i]] = i;
-    }
+    g_BcwCodingOrder[(uint32_t)g_BcwParsingOrder[i]] = i;
   }
 }
 
@@ -415,8 +412,7 @@ void initROM()
   }
 
   initGeoTemplate();
-
-  ::memset(g_isReusedUniMVsFilled, 0, sizeof(g_isReusedUniMVsFilled));
+  initBcwCodingOrder();
 
   for (int qp = 0; qp < 57; qp++)
   {
@@ -610,9 +606,6 @@ const uint32_t g_scalingListId[SCALING_LIST_SIZE_NUM][SCALING_LIST_NUM] =
   {  0,  0,  0,  0,  0,  0},  // SCALING_LIST_128x128
 };
 
-RefSetArray<Mv> g_reusedUniMVs[MAX_CU_SIZE_IN_PARTS][MAX_CU_SIZE_IN_PARTS][MAX_NUM_SIZES][MAX_NUM_SIZES];
-bool g_isReusedUniMVsFilled[MAX_CU_SIZE_IN_PARTS][MAX_CU_SIZE_IN_PARTS][MAX_NUM_SIZES][MAX_NUM_SIZES];
-
 uint16_t g_paletteQuant[57];
 uint8_t g_paletteRunTopLut [5] = { 0, 1, 1, 2, 2 };
 uint8_t g_paletteRunLeftLut[5] = { 0, 1, 2, 3, 4 };
@@ -164,7 +164,9 @@ inline bool isNonLog2Size( const SizeType& size )
 
 extern UnitScale     g_miScaling; // scaling object for motion scaling
 
-/*! Sophisticated Trace-logging */
+/*! Sophisticated Trace-logging
+ *  The trace context is owned by the application, which creates it before any encoder or decoder instance and keeps
+ *  it until exit. It is not thread-safe: builds with ENABLE_TRACING never code pictures or CTUs concurrently. */
 #if ENABLE_TRACING
 #include "dtrace.h"
 extern CDTrace* g_trace_ctx;
@@ -187,12 +189,10 @@ extern MsgLevel g_verbosity;
 
 extern const int8_t g_BcwWeights[BCW_NUM];
 extern const int8_t g_BcwSearchOrder[BCW_NUM];
-extern       int8_t g_BcwCodingOrder[BCW_NUM];
-extern       int8_t g_BcwParsingOrder[BCW_NUM];
+extern       int8_t g_BcwCodingOrder[BCW_NUM];    ///< filled once by initROM(), read-only afterwards
+extern       int8_t g_BcwParsingOrder[BCW_NUM];   ///< filled once by initROM(), read-only afterwards
 
-class CodingStructure;
 int8_t   getBcwWeight(uint8_t bcwIdx, uint8_t refFrameList);
-void     resetBcwCodingOrder(bool runDecoding, const CodingStructure &cs);
 uint32_t deriveWeightIdxBits(uint8_t bcwIdx);
 
 //! \}
@@ -200,9 +200,6 @@ uint32_t deriveWeightIdxBits(uint8_t bcwIdx);
 
 extern bool g_mctsDecCheckEnabled;
 
-class  Mv;
-extern RefSetArray<Mv> g_reusedUniMVs[MAX_CU_SIZE_IN_PARTS][MAX_CU_SIZE_IN_PARTS][MAX_NUM_SIZES][MAX_NUM_SIZES];
-extern bool g_isReusedUniMVsFilled[MAX_CU_SIZE_IN_PARTS][MAX_CU_SIZE_IN_PARTS][MAX_NUM_SIZES][MAX_NUM_SIZES];
 
 extern uint16_t g_paletteQuant[57];
 extern uint8_t g_paletteRunTopLut[5];
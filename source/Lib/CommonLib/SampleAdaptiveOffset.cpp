@@ -556,6 +556,8 @@ void SampleAdaptiveOffset::offsetCTU(const UnitArea &area, const CPelUnitBuf &sr
     return;
   }
 
+  const Slice &slice = *cs.getCU(area.lumaPos(), ChannelType::LUMA)->slice;
+
   bool isLeftAvail, isRightAvail, isAboveAvail, isBelowAvail, isAboveLeftAvail, isAboveRightAvail, isBelowLeftAvail, isBelowRightAvail;
 
   //block boundary availability
@@ -626,7 +628,7 @@ void SampleAdaptiveOffset::offsetCTU(const UnitArea &area, const CPelUnitBuf &sr
         }
       }
 #endif
-      offsetBlock(cs.sps->getBitDepth(toChannelType(compID)), cs.slice->clpRng(compID), ctbOffset.typeIdc.newType,
+      offsetBlock(cs.sps->getBitDepth(toChannelType(compID)), slice.clpRng(compID), ctbOffset.typeIdc.newType,
                   ctbOffset.offset, srcBlk, resBlk, srcStride, resStride, compArea.width, compArea.height, isLeftAvail,
                   isRightAvail, isAboveAvail, isBelowAvail, isAboveLeftAvail, isAboveRightAvail, isBelowLeftAvail,
                   isBelowRightAvail, isCtuCrossedByVirtualBoundaries, horVirBndryPosComp, verVirBndryPosComp,
@@ -683,6 +685,59 @@ void SampleAdaptiveOffset::SAOProcess( CodingStructure& cs, SAOBlkParam* saoBlkP
   DTRACE_CRC( g_trace_ctx, D_CRC, cs, cs.getRecoBuf() );
 }
 
+void SampleAdaptiveOffset::SAOProcessCtuRow(CodingStructure &cs, SAOBlkParam *saoBlkParams, const int ctuRow)
+{
+  CHECK(!saoBlkParams, "No parameters present");
+
+  const PreCalcValues &pcv                = *cs.pcv;
+  const uint32_t       numberOfComponents = getNumberValidComponents(pcv.chrFormat);
+  const int            firstCtuRsAddr     = ctuRow * pcv.widthInCtus;
+  const int            endCtuRsAddr       = std::min<int>(firstCtuRsAddr + 2 * pcv.widthInCtus, pcv.sizeInCtus);
+
+  // the samples of this row and the first line of the next one are only needed when SAO is used in either row, as
+  // the row below takes its above neighbours from the copy made here (merged parameters are not resolved yet)
+  bool rowsEnabled = false;
+  for (int ctuRsAddr = firstCtuRsAddr; ctuRsAddr < endCtuRsAddr; ctuRsAddr++)
+  {
+    for (uint32_t compIdx = 0; compIdx < numberOfComponents; compIdx++)
+    {
+      rowsEnabled |= saoBlkParams[ctuRsAddr][compIdx].modeIdc != SAOMode::OFF;
+    }
+  }
+
+  for (int ctuRsAddr = firstCtuRsAddr; ctuRsAddr < firstCtuRsAddr + pcv.widthInCtus; ctuRsAddr++)
+  {
+    MergeBlkParams mergeList;
+    mergeList.fill(nullptr);
+    getMergeList(cs, ctuRsAddr, saoBlkParams, mergeList);
+
+    reconstructBlkSAOParam(saoBlkParams[ctuRsAddr], mergeList);
+  }
+
+  if (!rowsEnabled)
+  {
+    return;
+  }
+
+  // the deblocked samples of the row incl. the first (chroma) line below, the line above has been saved by the
+  // previous row before applying its offsets
+  const uint32_t yPos     = ctuRow * pcv.maxCUHeight;
+  const uint32_t copyEnd  = std::min(yPos + pcv.maxCUHeight + (1 << getChannelTypeScaleY(ChannelType::CHROMA, pcv.chrFormat)), pcv.lumaHeight);
+  const UnitArea copyArea(pcv.chrFormat, Area(0, yPos, pcv.lumaWidth, copyEnd - yPos));
+  PelUnitBuf     rec = cs.getRecoBuf();
+  m_tempBuf.subBuf(copyArea).copyFrom(rec.subBuf(copyArea));
+
+  int ctuRsAddr = firstCtuRsAddr;
+  for (uint32_t xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth, ctuRsAddr++)
+  {
+    const uint32_t width  = (xPos + pcv.maxCUWidth  > pcv.lumaWidth)  ? (pcv.lumaWidth - xPos)  : pcv.maxCUWidth;
+    const uint32_t height = (yPos + pcv.maxCUHeight > pcv.lumaHeight) ? (pcv.lumaHeight - yPos) : pcv.maxCUHeight;
+    const UnitArea area( pcv.chrFormat, Area(xPos , yPos, width, height) );
+
+    offsetCTU(area, m_tempBuf, rec, saoBlkParams[ctuRsAddr], cs);
+  }
+}
+
 void SampleAdaptiveOffset::deriveLoopFilterBoundaryAvailability(CodingStructure &cs, const Position &pos,
                                                                 bool &isLeftAvail, bool &isRightAvail,
                                                                 bool &isAboveAvail, bool &isBelowAvail,
@@ -62,6 +62,9 @@ public:
   virtual ~SampleAdaptiveOffset();
 
   void SAOProcess(CodingStructure &cs, SAOBlkParam *saoBlkParams);
+  /// applies SAO to one CTU row, whose deblocking has to be complete, as has the one of the row below. Rows have to be
+  /// processed top to bottom, the active slice of the coding structure is not used.
+  void SAOProcessCtuRow(CodingStructure &cs, SAOBlkParam *saoBlkParams, const int ctuRow);
   void create(int picWidth, int picHeight, ChromaFormat format, uint32_t maxCUWidth, uint32_t maxCUHeight,
               uint32_t maxCUDepth, uint32_t lumaBitShift, uint32_t chromaBitShift);
   void setReshaper(Reshape *p) { m_pcReshape = p; }
@@ -483,7 +483,12 @@ void Slice::constructRefPicList(PicList& rcListPic)
       if (isActiveRef)
       {
         CHECK(refPic == nullptr, "Active reference picture not found");
-        refPic->extendPicBorder(getSPS(), getPPS());
+        // pictures still being loop filtered in the background get their borders extended once they are finished
+        if (refPic->isDecodingFinished() || refPic->isWrapAroundEnabled(getSPS(), getPPS()))
+        {
+          refPic->waitForDecodingFinished();
+          refPic->extendPicBorder(getSPS(), getPPS());
+        }
         m_apcRefPicList[l][refIdx]     = refPic;
         m_bIsUsedAsLongTerm[l][refIdx] = refPic->longTerm;
       }
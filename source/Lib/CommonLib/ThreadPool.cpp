@@ -0,0 +1,168 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2025, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     ThreadPool.cpp
+    \brief    simple pool of worker threads used for parallel decoding and encoding stages
+*/
+
+#include "ThreadPool.h"
+
+#include "CommonDef.h"
+
+//! \ingroup CommonLib
+//! \{
+
+// ====================================================================================================================
+// WaitCounter
+// ====================================================================================================================
+
+void WaitCounter::increment()
+{
+  std::unique_lock<std::mutex> lock( m_mutex );
+  m_count++;
+}
+
+void WaitCounter::decrement()
+{
+  std::unique_lock<std::mutex> lock( m_mutex );
+  CHECK( m_count <= 0, "Unbalanced wait counter" );
+  if( --m_count == 0 )
+  {
+    m_cond.notify_all();
+  }
+}
+
+void WaitCounter::setException( std::exception_ptr e )
+{
+  std::unique_lock<std::mutex> lock( m_mutex );
+  if( !m_exception )
+  {
+    m_exception = e;
+  }
+}
+
+bool WaitCounter::hasException()
+{
+  std::unique_lock<std::mutex> lock( m_mutex );
+  return m_exception != nullptr;
+}
+
+void WaitCounter::wait()
+{
+  std::unique_lock<std::mutex> lock( m_mutex );
+  m_cond.wait( lock, [this] { return m_count == 0; } );
+  if( m_exception )
+  {
+    std::exception_ptr e = m_exception;
+    m_exception          = nullptr;
+    std::rethrow_exception( e );
+  }
+}
+
+// ====================================================================================================================
+// ThreadPool
+// ====================================================================================================================
+
+ThreadPool::ThreadPool( int numThreads )
+  : m_exit( false )
+{
+  CHECK( numThreads < 1, "A thread pool needs at least one thread" );
+  for( int i = 0; i < numThreads; i++ )
+  {
+    m_threads.emplace_back( &ThreadPool::threadProc, this, i );
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_exit = true;
+  }
+  m_cond.notify_all();
+  for( auto &t: m_threads )
+  {
+    t.join();
+  }
+}
+
+void ThreadPool::addTask( TaskFunc func, WaitCounter *counter )
+{
+  if( counter )
+  {
+    counter->increment();
+  }
+  {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_tasks.push_back( Task{ std::move( func ), counter } );
+  }
+  m_cond.notify_one();
+}
+
+void ThreadPool::threadProc( int threadIdx )
+{
+  while( true )
+  {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock( m_mutex );
+      m_cond.wait( lock, [this] { return m_exit || !m_tasks.empty(); } );
+      if( m_tasks.empty() )
+      {
+        return;
+      }
+      task = std::move( m_tasks.front() );
+      m_tasks.pop_front();
+    }
+
+    try
+    {
+      task.func( threadIdx );
+    }
+    catch( ... )
+    {
+      if( !task.counter )
+      {
+        throw;
+      }
+      task.counter->setException( std::current_exception() );
+    }
+
+    if( task.counter )
+    {
+      task.counter->decrement();
+    }
+  }
+}
+
+//! \}
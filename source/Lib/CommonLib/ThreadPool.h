@@ -0,0 +1,112 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2025, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     ThreadPool.h
+    \brief    simple pool of worker threads used for parallel decoding and encoding stages
+*/
+
+#ifndef __THREADPOOL__
+#define __THREADPOOL__
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//! \ingroup CommonLib
+//! \{
+
+// ====================================================================================================================
+// Class definition
+// ====================================================================================================================
+
+/// counts outstanding tasks of one job and collects the first exception thrown by any of them
+class WaitCounter
+{
+public:
+  WaitCounter() : m_count( 0 ) {}
+
+  void increment();
+  void decrement();
+  void setException( std::exception_ptr e );
+  bool hasException();
+
+  /// blocks until all counted tasks have finished, rethrows the first exception thrown by one of them
+  void wait();
+
+private:
+  std::mutex              m_mutex;
+  std::condition_variable m_cond;
+  int                     m_count;
+  std::exception_ptr      m_exception;
+};
+
+/// fixed-size pool of worker threads processing tasks in FIFO order
+///
+/// A task may block waiting for the completion of tasks that were queued before it, but never for a task queued
+/// after it, otherwise the pool can deadlock.
+class ThreadPool
+{
+public:
+  typedef std::function<void( int threadIdx )> TaskFunc;   ///< threadIdx in [0, getNumThreads()) identifies the worker
+
+  ThreadPool( int numThreads );
+  ~ThreadPool();
+
+  int  getNumThreads() const { return (int) m_threads.size(); }
+
+  /// queues a task, the counter (if any) is incremented now and decremented once the task has finished
+  void addTask( TaskFunc func, WaitCounter *counter );
+
+private:
+  struct Task
+  {
+    TaskFunc     func;
+    WaitCounter *counter;
+  };
+
+  void threadProc( int threadIdx );
+
+  std::vector<std::thread> m_threads;
+  std::deque<Task>         m_tasks;
+  std::mutex               m_mutex;
+  std::condition_variable  m_cond;
+  bool                     m_exit;
+};
+
+//! \}
+
+#endif // __THREADPOOL__
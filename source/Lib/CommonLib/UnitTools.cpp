@@ -69,28 +69,7 @@ void CS::setRefinedMotionField(CodingStructure &cs)
     {
       if (PU::checkDMVRCondition(pu))
       {
-        PredictionUnit subPu = pu;
-        const int      dy    = std::min<int>(pu.lumaSize().height, DMVR_SUBCU_HEIGHT);
-        const int      dx    = std::min<int>(pu.lumaSize().width, DMVR_SUBCU_WIDTH);
-        Position       puPos = pu.lumaPos();
-        int            num   = 0;
-
-        for (int y = puPos.y; y < (puPos.y + pu.lumaSize().height); y = y + dy)
-        {
-          for (int x = puPos.x; x < (puPos.x + pu.lumaSize().width); x = x + dx)
-          {
-            subPu.UnitArea::operator=(UnitArea(pu.chromaFormat, Area(x, y, dx, dy)));
-            subPu.mv[0] = pu.mv[0];
-            subPu.mv[1] = pu.mv[1];
-            subPu.mv[REF_PIC_LIST_0] += pu.mvdL0SubPu[num];
-            subPu.mv[REF_PIC_LIST_1] -= pu.mvdL0SubPu[num];
-            subPu.mv[REF_PIC_LIST_0].clipToStorageBitDepth();
-            subPu.mv[REF_PIC_LIST_1].clipToStorageBitDepth();
-            pu.mvdL0SubPu[num].setZero();
-            num++;
-            PU::spanMotionInfo(subPu);
-          }
-        }
+        PU::setRefinedMotionField(pu);
       }
     }
   }
@@ -376,9 +355,11 @@ void CU::saveMotionForHmvp(const CodingUnit &cu)
 #endif
     mi.bcwIdx = mi.interDir == 3 ? cu.bcwIdx : BCW_DEFAULT;
 
+    LutMotionCand &motionLut = cu.cs->getMotionLut(cu.lumaPos());
+
     if (CU::isIBC(cu))
     {
-      cu.cs->addMiToLut(cu.cs->motionLut.lutIbc, mi);
+      cu.cs->addMiToLut(motionLut.lutIbc, mi);
     }
     else
     {
@@ -387,7 +368,7 @@ void CU::saveMotionForHmvp(const CodingUnit &cu)
 
       if ((((area.x + area.width) ^ area.x) & mask) != 0 && (((area.y + area.height) ^ area.y) & mask) != 0)
       {
-        cu.cs->addMiToLut(cu.cs->motionLut.lut, mi);
+        cu.cs->addMiToLut(motionLut.lut, mi);
       }
     }
   }
@@ -833,19 +814,21 @@ int PU::getWideAngle( const TransformUnit &tu, const uint32_t dirMode, const Com
   return predMode;
 }
 
-bool PU::addMergeHmvpCand(const CodingStructure &cs, MergeCtx &mrgCtx, const int &mrgCandIdx,
+bool PU::addMergeHmvpCand(const PredictionUnit &pu, MergeCtx &mrgCtx, const int &mrgCandIdx,
                           const uint32_t maxNumMergeCandMin1, int &cnt, const bool isAvailableA1,
                           const MotionInfo &miLeft, const bool isAvailableB1, const MotionInfo &miAbove,
                           const bool ibcFlag, const bool isGt4x4
 #if GDR_ENABLED
                           ,
-                          const PredictionUnit &pu, bool &allCandSolidInAbove
+                          bool &allCandSolidInAbove
 #endif
 )
 {
-  const Slice &slice = *cs.slice;
+  const CodingStructure &cs    = *pu.cs;
+  const Slice           &slice = *cs.slice;
 
-  const auto &lut = ibcFlag ? cs.motionLut.lutIbc : cs.motionLut.lut;
+  const LutMotionCand &motionLut = cs.getMotionLut(pu.lumaPos());
+  const auto          &lut       = ibcFlag ? motionLut.lutIbc : motionLut.lut;
 
   const int numAvailCandInLut = (int) lut.size();
 
@@ -1022,10 +1005,10 @@ void PU::getIBCMergeCandidates(const PredictionUnit& pu, MergeCtx& mrgCtx, const
   {
 #if GDR_ENABLED
     bool allCandSolidInAbove = true;
-    const bool found = addMergeHmvpCand(cs, mrgCtx, mrgCandIdx, maxNumMergeCand, cnt, isAvailableA1, miLeft,
-                                        isAvailableB1, miAbove, true, isGt4x4, pu, allCandSolidInAbove);
+    const bool found = addMergeHmvpCand(pu, mrgCtx, mrgCandIdx, maxNumMergeCand, cnt, isAvailableA1, miLeft,
+                                        isAvailableB1, miAbove, true, isGt4x4, allCandSolidInAbove);
 #else
-    const bool found = addMergeHmvpCand(cs, mrgCtx, mrgCandIdx, maxNumMergeCand, cnt, isAvailableA1, miLeft,
+    const bool found = addMergeHmvpCand(pu, mrgCtx, mrgCandIdx, maxNumMergeCand, cnt, isAvailableA1, miLeft,
                                         isAvailableB1, miAbove, true, isGt4x4);
 #endif
 
@@ -1505,10 +1488,10 @@ void PU::getInterMergeCandidates(const PredictionUnit &pu, MergeCtx &mrgCtx, int
     allCandSolidInAbove = true;
 #endif
 #if GDR_ENABLED
-    bool found = addMergeHmvpCand(cs, mrgCtx, mrgCandIdx, maxNumMergeCandMin1, cnt, isAvailableA1, miLeft,
-                                  isAvailableB1, miAbove, CU::isIBC(*pu.cu), isGt4x4, pu, allCandSolidInAbove);
+    bool found = addMergeHmvpCand(pu, mrgCtx, mrgCandIdx, maxNumMergeCandMin1, cnt, isAvailableA1, miLeft,
+                                  isAvailableB1, miAbove, CU::isIBC(*pu.cu), isGt4x4, allCandSolidInAbove);
 #else
-    bool found = addMergeHmvpCand(cs, mrgCtx, mrgCandIdx, maxNumMergeCandMin1, cnt, isAvailableA1, miLeft,
+    bool found = addMergeHmvpCand(pu, mrgCtx, mrgCandIdx, maxNumMergeCandMin1, cnt, isAvailableA1, miLeft,
                                   isAvailableB1, miAbove, CU::isIBC(*pu.cu), isGt4x4);
 #endif
 
@@ -1698,6 +1681,32 @@ bool PU::checkDMVRCondition(const PredictionUnit& pu)
   }
 }
 
+void PU::setRefinedMotionField(PredictionUnit &pu)
+{
+  PredictionUnit subPu = pu;
+  const int      dy    = std::min<int>(pu.lumaSize().height, DMVR_SUBCU_HEIGHT);
+  const int      dx    = std::min<int>(pu.lumaSize().width, DMVR_SUBCU_WIDTH);
+  Position       puPos = pu.lumaPos();
+  int            num   = 0;
+
+  for (int y = puPos.y; y < (puPos.y + pu.lumaSize().height); y = y + dy)
+  {
+    for (int x = puPos.x; x < (puPos.x + pu.lumaSize().width); x = x + dx)
+    {
+      subPu.UnitArea::operator=(UnitArea(pu.chromaFormat, Area(x, y, dx, dy)));
+      subPu.mv[0] = pu.mv[0];
+      subPu.mv[1] = pu.mv[1];
+      subPu.mv[REF_PIC_LIST_0] += pu.mvdL0SubPu[num];
+      subPu.mv[REF_PIC_LIST_1] -= pu.mvdL0SubPu[num];
+      subPu.mv[REF_PIC_LIST_0].clipToStorageBitDepth();
+      subPu.mv[REF_PIC_LIST_1].clipToStorageBitDepth();
+      pu.mvdL0SubPu[num].setZero();
+      num++;
+      PU::spanMotionInfo(subPu);
+    }
+  }
+}
+
 static int xGetDistScaleFactor(const int &currPoc, const int &currRefPoc, const int &colPoc, const int &colRefPoc)
 {
   const int diffPocD = colPoc - colRefPoc;
@@ -2003,10 +2012,11 @@ void PU::getIbcMVPsEncOnly(PredictionUnit &pu, static_vector<Mv, IBC_NUM_CANDIDA
     }
   }
 
-  size_t numAvaiCandInLUT = pu.cs->motionLut.lutIbc.size();
+  const auto &lutIbc           = pu.cs->getMotionLut(pu.lumaPos()).lutIbc;
+  size_t      numAvaiCandInLUT = lutIbc.size();
   for (uint32_t cand = 0; cand < numAvaiCandInLUT && mvPred.size() < mvPred.max_size(); cand++)
   {
-    MotionInfo neibMi = pu.cs->motionLut.lutIbc[cand];
+    MotionInfo neibMi = lutIbc[cand];
     addNeighborMv(neibMi.bv, mvPred);
   }
 
@@ -2975,7 +2985,8 @@ void PU::addAMVPHMVPCand(const PredictionUnit &pu, const RefPicList eRefPicList,
   const Slice &slice = *(*pu.cs).slice;
 
   MotionInfo neibMi;
-  auto &lut = CU::isIBC(*pu.cu) ? pu.cs->motionLut.lutIbc : pu.cs->motionLut.lut;
+  const LutMotionCand &motionLut = pu.cs->getMotionLut(pu.lumaPos());
+  auto                &lut       = CU::isIBC(*pu.cu) ? motionLut.lutIbc : motionLut.lut;
   int              numAvailCandInLut = (int) lut.size();
   int              numAllowedCand    = std::min(MAX_NUM_HMVP_AVMPCANDS, numAvailCandInLut);
   const RefPicList eRefPicList2nd = (eRefPicList == REF_PIC_LIST_0) ? REF_PIC_LIST_1 : REF_PIC_LIST_0;
@@ -167,13 +167,13 @@ namespace PU
                           Mv rcMv[3], bool rcMvSolid[3], MvpType rcMvType[3], Position rcMvPos[3]);
 #endif
   void xInheritedAffineMv             ( const PredictionUnit &pu, const PredictionUnit* puNeighbour, RefPicList eRefPicList, Mv rcMv[3] );
-  bool addMergeHmvpCand(const CodingStructure &cs, MergeCtx &mrgCtx, const int &mrgCandIdx,
+  bool addMergeHmvpCand(const PredictionUnit &pu, MergeCtx &mrgCtx, const int &mrgCandIdx,
                         const uint32_t maxNumMergeCandMin1, int &cnt, const bool isAvailableA1,
                         const MotionInfo &miLeft, const bool isAvailableB1, const MotionInfo &miAbove,
                         const bool ibcFlag, const bool isGt4x4
 #if GDR_ENABLED
                         ,
-                        const PredictionUnit &pu, bool &allCandSolidInAbove
+                        bool &allCandSolidInAbove
 #endif
   );
   void addAMVPHMVPCand                (const PredictionUnit &pu, const RefPicList eRefPicList, const Picture* currRefPic, AMVPInfo &info);
@@ -204,6 +204,7 @@ namespace PU
   void getIbcMVPsEncOnly(PredictionUnit &pu, static_vector<Mv, IBC_NUM_CANDIDATES>& mvPred);
   bool getDerivedBV(PredictionUnit &pu, const Mv& currentMv, Mv& derivedMv);
   bool checkDMVRCondition(const PredictionUnit& pu);
+  void setRefinedMotionField(PredictionUnit &pu);
   void getNeighborAffineInfo(const PredictionUnit& pu, int& numNeighborAvai, int& numNeighborAffine);
 
   static inline bool dmvrBdofSizeCheck(const PredictionUnit &pu)
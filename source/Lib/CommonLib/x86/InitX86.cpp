@@ -50,6 +50,8 @@
 
 #include "CommonLib/IbcHashMap.h"
 
+#include <mutex>
+
 #ifdef TARGET_SIMD_X86
 
 
@@ -78,22 +80,27 @@ void InterpolationFilter::initInterpolationFilterX86( /*int iBitDepthY, int iBit
 #if ENABLE_SIMD_OPT_BUFFER
 void PelBufferOps::initPelBufOpsX86()
 {
-  auto vext = read_x86_extension_flags();
-  switch (vext){
-    case AVX512:
-    case AVX2:
-      _initPelBufOpsX86<AVX2>();
-      break;
-    case AVX:
-      _initPelBufOpsX86<AVX>();
-      break;
-    case SSE42:
-    case SSE41:
-      _initPelBufOpsX86<SSE41>();
-      break;
-    default:
-      break;
-  }
+  // every encoder and decoder instance requests the initialization of the shared table, possibly while other
+  // instances already use it: the function pointers are thus only written once per process
+  static std::once_flag initFlag;
+  std::call_once(initFlag, [this]() {
+    auto vext = read_x86_extension_flags();
+    switch (vext){
+      case AVX512:
+      case AVX2:
+        _initPelBufOpsX86<AVX2>();
+        break;
+      case AVX:
+        _initPelBufOpsX86<AVX>();
+        break;
+      case SSE42:
+      case SSE41:
+        _initPelBufOpsX86<SSE41>();
+        break;
+      default:
+        break;
+    }
+  });
 }
 #endif
 
@@ -38,6 +38,8 @@
 
 
 #include <stdint.h>
+#include <cstring>
+#include <algorithm>
 #include <vector>
 #include "AnnexBread.h"
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
@@ -47,6 +49,105 @@
 //! \ingroup DecoderLib
 //! \{
 
+/**
+ * Position of the first three-byte sequence 0x000000, 0x000001 or
+ * 0x000002 in [begin, end), which ends a NAL unit, or end if there
+ * is none.  The zero bytes are found with memchr, which checks many
+ * bytes at a time, instead of looking at every byte.
+ */
+const uint8_t *findNalUnitEnd(const uint8_t *begin, const uint8_t *end)
+{
+  const uint8_t *p = begin;
+  while (end - p >= 3)
+  {
+    p = static_cast<const uint8_t *>(memchr(p, 0, end - p - 2));
+    if (p == nullptr)
+    {
+      return end;
+    }
+    if (p[1] == 0 && p[2] <= 2)
+    {
+      return p;
+    }
+    // a zero second byte may still start the sequence, otherwise the sequence cannot start before p + 2
+    p += p[1] == 0 ? 1 : 2;
+  }
+  return end;
+}
+
+bool InputByteStream::xReadBlocks(size_t n)
+{
+  // the consumed data is dropped, unless it is looked ahead from
+  const size_t keepPos = m_isLookahead ? m_lookaheadPos : m_readPos;
+  if (keepPos > 0)
+  {
+    m_buffer.erase(m_buffer.begin(), m_buffer.begin() + keepPos);
+    m_readPos -= keepPos;
+    m_lookaheadPos -= m_isLookahead ? keepPos : 0;
+  }
+
+  while (m_buffer.size() - m_readPos < n)
+  {
+    const size_t size = m_buffer.size();
+    m_buffer.resize(size + BLOCK_SIZE);
+    const std::streamsize numRead = m_input.rdbuf()->sgetn(reinterpret_cast<char *>(m_buffer.data() + size), BLOCK_SIZE);
+    m_buffer.resize(size + std::max<std::streamsize>(numRead, 0));
+    if (numRead <= 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Set the end of file state of the input stream, as reading a byte
+ * beyond the end of the stream does.  This throws the exception
+ * std::ios_base::failure, which is passed on if raise is set.
+ */
+void InputByteStream::xSetEof(bool raise)
+{
+  try
+  {
+    m_input.setstate(std::istream::eofbit | std::istream::failbit);
+  }
+  catch (...)
+  {
+    if (raise)
+    {
+      throw;
+    }
+  }
+}
+
+size_t InputByteStream::readNalUnitPayload(std::vector<uint8_t> &nalUnit)
+{
+  size_t scanPos = m_readPos;
+  while (true)
+  {
+    const uint8_t *begin = m_buffer.data() + m_readPos;
+    const uint8_t *end   = findNalUnitEnd(m_buffer.data() + scanPos, m_buffer.data() + m_buffer.size());
+    if (end < m_buffer.data() + m_buffer.size())
+    {
+      nalUnit.insert(nalUnit.end(), begin, end);
+      m_readPos += end - begin;
+      return end - begin;
+    }
+
+    // the end of the NAL unit is not read yet, the last two bytes may start the sequence ending it
+    const size_t numAvailable = m_buffer.size() - m_readPos;
+    const size_t scanOffset   = std::max<size_t>(numAvailable, 2) - 2;
+    if (!xFill(numAvailable + 1))
+    {
+      // the NAL unit ends with the stream
+      nalUnit.insert(nalUnit.end(), m_buffer.begin() + m_readPos, m_buffer.end());
+      m_readPos = m_buffer.size();
+      return numAvailable;
+    }
+    scanPos = m_readPos + scanOffset;
+  }
+}
+
 /**
  * Parse an AVC AnnexB Bytestream bs to extract a single nalUnit
  * while accumulating bytestream statistics into stats.
@@ -142,14 +243,17 @@ static void _byteStreamNALUnit(InputByteStream &bs, std::vector<uint8_t> &nalUni
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
   CodingStatistics::SStat &bodyStats=CodingStatistics::GetStatisticEP(STATS__NAL_UNIT_TOTAL_BODY);
 #endif
-  while (bs.eofBeforeNBytes(24/8) || bs.peekBytes(24/8) > 2)
-  {
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
-    uint8_t thebyte=bs.readByte();bodyStats.bits+=8;bodyStats.count++;
-    nalUnit.push_back(thebyte);
+  const uint32_t numBytesInNalUnit = uint32_t(bs.readNalUnitPayload(nalUnit));
+  bodyStats.bits += 8 * numBytesInNalUnit;
+  bodyStats.count += numBytesInNalUnit;
 #else
-    nalUnit.push_back(bs.readByte());
+  bs.readNalUnitPayload(nalUnit);
 #endif
+  if (bs.eofBeforeNBytes(24/8))
+  {
+    // the NAL unit ends with the byte stream, reading on reports the end of file
+    bs.readByte();
   }
 
   /* 5. When the current position in the byte stream is:
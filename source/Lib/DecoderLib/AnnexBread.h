@@ -52,26 +52,38 @@ class InputByteStream
 public:
   /**
    * Create a bytestream reader that will extract bytes from
-   * istream.
+   * istream.  The input is read in blocks into an internal buffer,
+   * which also holds the data looked ahead, so istream is never
+   * seeked and may as well be a pipe.
    *
    * NB, it isn't safe to access istream while in use by a
    * InputByteStream.
    *
    * Side-effects: the exception mask of istream is set to eofbit
    */
-  InputByteStream(std::istream &istream) : m_numFutureBytes(0), m_futureBytes(0), m_input(istream)
+  InputByteStream(std::istream &istream) : m_input(istream)
   {
     istream.exceptions(std::istream::eofbit | std::istream::badbit);
   }
 
   /**
-   * Reset the internal state.  Must be called if input stream is
-   * modified externally to this class
+   * Start looking ahead.  The data from the current position on is
+   * kept, so that endLookahead() returns to the current position.
    */
-  void reset()
+  void startLookahead()
   {
-    m_numFutureBytes = 0;
-    m_futureBytes    = 0;
+    m_lookaheadPos = m_readPos;
+    m_isLookahead  = true;
+  }
+
+  /**
+   * Return to the position at which the lookahead was started.
+   */
+  void endLookahead()
+  {
+    CHECK(!m_isLookahead, "No lookahead started");
+    m_readPos     = m_lookaheadPos;
+    m_isLookahead = false;
   }
 
   /**
@@ -81,25 +93,12 @@ public:
   bool eofBeforeNBytes(uint32_t n)
   {
     CHECK(n > 4, "Unsupported look-ahead value");
-    if (m_numFutureBytes >= n)
+    if (xFill(n))
     {
       return false;
     }
-
-    n -= m_numFutureBytes;
-    try
-    {
-      for (uint32_t i = 0; i < n; i++)
-      {
-        m_futureBytes = (m_futureBytes << 8) | m_input.get();
-        m_numFutureBytes++;
-      }
-    }
-    catch (...)
-    {
-      return true;
-    }
-    return false;
+    xSetEof(false);
+    return true;
   }
 
   /**
@@ -117,7 +116,12 @@ public:
   uint32_t peekBytes(uint32_t n)
   {
     eofBeforeNBytes(n);
-    return m_futureBytes >> 8 * (m_numFutureBytes - n);
+    uint32_t val = 0;
+    for (uint32_t i = 0; i < n; i++)
+    {
+      val = (val << 8) | (m_readPos + i < m_buffer.size() ? m_buffer[m_readPos + i] : 0);
+    }
+    return val;
   }
 
   /**
@@ -128,15 +132,11 @@ public:
    */
   uint8_t readByte()
   {
-    if (m_numFutureBytes == 0)
+    if (!xFill(1))
     {
-      uint8_t byte = m_input.get();
-      return byte;
+      xSetEof(true);
     }
-    m_numFutureBytes--;
-    const uint8_t wantedByte = m_futureBytes >> 8 * m_numFutureBytes;
-    m_futureBytes &= ~(0xff << 8 * m_numFutureBytes);
-    return wantedByte;
+    return m_buffer[m_readPos++];
   }
 
   /**
@@ -154,14 +154,31 @@ public:
     return val;
   }
 
-#if RExt__DECODER_DEBUG_BIT_STATISTICS
-  uint32_t getNumBufferedBytes() const { return m_numFutureBytes; }
-#endif
+  /**
+   * consume the bytes up to the next three-byte sequence 0x000000,
+   * 0x000001 or 0x000002, or up to the end of the stream, and append
+   * them to nalUnit.
+   *
+   * Returns: the number of bytes consumed
+   */
+  size_t readNalUnitPayload(std::vector<uint8_t> &nalUnit);
 
 private:
-  uint32_t      m_numFutureBytes; /* number of valid bytes in m_futureBytes */
-  uint32_t      m_futureBytes;    /* bytes that have been peeked */
-  std::istream &m_input;          /* Input stream to read from */
+  static constexpr size_t BLOCK_SIZE = 1 << 16;
+
+  /// read further input until n bytes follow the read position, false if the stream ends before
+  bool xFill(size_t n)
+  {
+    return m_buffer.size() - m_readPos >= n || xReadBlocks(n);
+  }
+  bool xReadBlocks(size_t n);
+  void xSetEof(bool raise);
+
+  std::istream        &m_input;               /* Input stream to read from */
+  std::vector<uint8_t> m_buffer;              /* input read from the stream and not consumed yet */
+  size_t               m_readPos      = 0;    /* position of the next byte in m_buffer */
+  size_t               m_lookaheadPos = 0;    /* position to return to after looking ahead */
+  bool                 m_isLookahead  = false;
 };
 
 /**
@@ -188,4 +205,6 @@ struct AnnexBStats
 
 bool byteStreamNALUnit(InputByteStream& bs, std::vector<uint8_t>& nalUnit, AnnexBStats& stats);
 
+const uint8_t *findNalUnitEnd(const uint8_t *begin, const uint8_t *end);
+
 //! \}
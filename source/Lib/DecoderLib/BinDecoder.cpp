@@ -66,7 +66,7 @@ void BinDecoderBase::start()
   CodingStatistics::UpdateCABACStat(STATS__CABAC_INITIALISATION, 512, 510, 0);
 #endif
   m_range       = 510;
-  m_value       = (m_bitstream->readByte() << 8) + m_bitstream->readByte();
+  m_value       = m_bitstream->read(16);
   m_bitsNeeded  = -8;
 }
 
@@ -124,7 +124,25 @@ unsigned BinDecoderBase::decodeBinsEP( unsigned numBins )
   }
   unsigned remBins = numBins;
   unsigned bins    = 0;
-  while(   remBins > 8 )
+  while(   remBins > 16 )
+  {
+    // two bytes per refill, with a 64-bit value for the 16 bins decoded from them
+    uint64_t value       = (uint64_t(m_value) << 16) + (uint64_t(m_bitstream->read(16)) << (8 + m_bitsNeeded));
+    uint64_t scaledRange = uint64_t(m_range) << 23;
+    for( int i = 0; i < 16; i++ )
+    {
+      bins += bins;
+      scaledRange >>= 1;
+      if (value >= scaledRange)
+      {
+        bins    ++;
+        value -= scaledRange;
+      }
+    }
+    m_value = uint32_t(value);
+    remBins -= 16;
+  }
+  if( remBins > 8 )
   {
     m_value              = (m_value << 8) + (m_bitstream->readByte() << (8 + m_bitsNeeded));
     unsigned scaledRange = m_range << 15;
@@ -111,8 +111,16 @@ void DecCu::decompressCtu( CodingStructure& cs, const UnitArea& ctuArea )
     Position prevTmpPos;
     prevTmpPos.x = -1; prevTmpPos.y = -1;
 
-    for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, chType ), chType ) )
+    // cs.treeType is parse state, which may already belong to a later CTU when reconstruction runs in parallel
+    const UnitArea chArea = CS::isDualITree( cs ) ? ctuArea.singleChan( chType ) : ctuArea;
+
+    for( auto &currCU : cs.traverseCUs( chArea, chType ) )
     {
+      if( !chArea.contains( currCU ) )
+      {
+        // the CUs of the following CTU may be parsed concurrently and get linked in during the traversal
+        break;
+      }
       if(currCU.Y().valid())
       {
         const int vSize = std::min<int>(VPDU_SIZE, cs.slice->getSPS()->getMaxCUHeight());
@@ -601,8 +609,62 @@ void DecCu::xIntraRecACTQT(CodingUnit &cu)
 
 #include "CommonLib/dtrace_buffer.h"
 
+void DecCu::xWaitForRefSamples( const CodingUnit &cu )
+{
+  // with frame-parallel decoding, reference pictures may still be in the loop filter
+  if( CU::isIBC( cu ) )
+  {
+    return;
+  }
+  const Slice& slice      = *cu.slice;
+  const int    picWidth   = cu.cs->picture->lwidth();
+  const int    picHeight  = cu.cs->picture->lheight();
+  const bool   wrapAround = cu.cs->pps->getWrapAroundEnabledFlag();
+
+  for( const auto &pu: CU::traversePUs( cu ) )
+  {
+    for( const auto l: { REF_PIC_LIST_0, REF_PIC_LIST_1 } )
+    {
+      int refIdxBegin = pu.refIdx[l];
+      int refIdxEnd   = pu.refIdx[l] + 1;
+      if( cu.geoFlag )
+      {
+        // the motion of the geometric partitions is only stored after motion compensation
+        refIdxBegin = 0;
+        refIdxEnd   = slice.getNumRefIdx( l );
+      }
+      for( int refIdx = std::max( refIdxBegin, 0 ); refIdx < refIdxEnd; refIdx++ )
+      {
+        const Picture* refPic = slice.getRefPic( l, refIdx );
+        if( refPic->isDecodingFinished() )
+        {
+          continue;
+        }
+        const int mvHor = pu.mv[l].hor >> MV_FRACTIONAL_BITS_INTERNAL;
+        const int mvVer = pu.mv[l].ver >> MV_FRACTIONAL_BITS_INTERNAL;
+        // bottom-most reference row incl. interpolation filter taps and decoder side refinements
+        const int yBottom = pu.ly() + pu.lheight() + mvVer + 8;
+        const int xRight  = pu.lx() + pu.lwidth() + mvHor + 8;
+        if( cu.geoFlag || cu.affine || pu.mergeType != MergeType::DEFAULT_N || wrapAround
+            || slice.getScalingRatio( l, refIdx ) != SCALE_1X || pu.ly() + mvVer < 8 || yBottom >= picHeight
+            || pu.lx() + mvHor < 8 || xRight >= picWidth )
+        {
+          // sub-block or scaled motion, or the padded picture borders are needed (they are extended last)
+          refPic->waitForDecodingFinished();
+        }
+        else
+        {
+          refPic->waitForLumaRow( yBottom );
+        }
+      }
+    }
+  }
+}
+
 void DecCu::xReconInter(CodingUnit &cu)
 {
+  xWaitForRefSamples( cu );
+
   if( cu.geoFlag )
   {
     m_pcInterPred->motionCompensationGeo( cu, m_geoMrgCtx );
@@ -822,6 +884,13 @@ void DecCu::xDecodeInterTexture(CodingUnit &cu)
 
 void DecCu::xDeriveCuMvs(CodingUnit &cu)
 {
+  if( cu.slice->getPicHeader()->getEnableTMVPFlag() && !CU::isIBC( cu ) )
+  {
+    // temporal motion vector prediction reads the motion field of the collocated picture
+    const Slice& slice = *cu.slice;
+    slice.getRefPic( RefPicList( slice.isInterB() ? 1 - slice.getColFromL0Flag() : 0 ), slice.getColRefIdx() )->waitForMotionField();
+  }
+
   for( auto &pu : CU::traversePUs( cu ) )
   {
     MergeCtx mrgCtx;
@@ -77,6 +77,7 @@ protected:
   void xIntraRecACTQT(CodingUnit&      cu);
 
   void xReconInter        ( CodingUnit&      cu );
+  void xWaitForRefSamples ( const CodingUnit& cu );
   void xDecodeInterTexture( CodingUnit&      cu );
   void xReconIntraQT      ( CodingUnit&      cu );
 
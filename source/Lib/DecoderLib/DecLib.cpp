@@ -515,6 +515,8 @@ DecLib::DecLib()
   , m_ShutterFilterEnable(false)
   , m_debugPOC(-1)
   , m_debugCTU(-1)
+  , m_threadPool(nullptr)
+  , m_frameParallelDecoding(false)
   , m_opi(nullptr)
   , m_mTidExternalSet(false)
   , m_mTidOpiSet(false)
@@ -582,6 +584,8 @@ void DecLib::create()
 
 void DecLib::destroy()
 {
+  waitForLoopFilterJob();
+
   delete m_apcSlicePilot;
   m_apcSlicePilot = nullptr;
 
@@ -598,6 +602,24 @@ void DecLib::destroy()
   }
 
   m_cSliceDecoder.destroy();
+
+  delete m_threadPool;
+  m_threadPool = nullptr;
+}
+
+void DecLib::setNumThreads( int numThreads )
+{
+  waitForLoopFilterJob();
+  m_cSliceDecoder.destroyReconWorkers();
+  m_cSliceDecoder.setThreadPool( nullptr );
+  delete m_threadPool;
+  m_threadPool = nullptr;
+
+  if( numThreads > 1 )
+  {
+    m_threadPool = new ThreadPool( numThreads );
+    m_cSliceDecoder.setThreadPool( m_threadPool );
+  }
 }
 
 void DecLib::init(
@@ -617,6 +639,8 @@ void DecLib::init(
 
 void DecLib::deletePicBuffer ( )
 {
+  waitForLoopFilterJob();
+
   PicList::iterator  iterPic   = m_cListPic.begin();
   int                size      = int(m_cListPic.size());
 
@@ -631,6 +655,9 @@ void DecLib::deletePicBuffer ( )
   m_cALF.destroy();
   m_cSAO.destroy();
   m_deblockingFilter.destroy();
+  m_loopFilterJob.alf.destroy();
+  m_loopFilterJob.sao.destroy();
+  m_loopFilterJob.deblockingFilter.destroy();
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   m_cacheModel.reportSequence( );
   m_cacheModel.destroy( );
@@ -666,6 +693,10 @@ Picture* DecLib::xGetNewPicBuffer( const SPS &sps, const PPS &pps, const uint32_
   for(auto * p: m_cListPic)
   {
     pcPic = p;  // workaround because range-based for-loops don't work with existing variables
+    if( pcPic == m_loopFilterJob.pic )
+    {
+      continue;   // still loop filtered in the background
+    }
     if ( pcPic->reconstructed == false && ! pcPic->neededForOutput )
     {
       pcPic->neededForOutput = false;
@@ -682,6 +713,13 @@ Picture* DecLib::xGetNewPicBuffer( const SPS &sps, const PPS &pps, const uint32_
     }
   }
 
+  if( !bBufferIsAvailable && m_loopFilterJob.pic != nullptr )
+  {
+    // rather than extending the buffer, wait for the picture held by the loop filter job
+    waitForLoopFilterJob();
+    return xGetNewPicBuffer( sps, pps, temporalLayer, layerId );
+  }
+
   if( ! bBufferIsAvailable )
   {
     //There is no room for this picture, either because of faulty encoder or dropped NAL. Extend the buffer.
@@ -747,29 +785,64 @@ void DecLib::executeLoopFilters()
     return; // nothing to deblock
   }
 
+  if( isFrameParallelDecoding() )
+  {
+    return; // the loop filters run in the background, started by finishPicture()
+  }
+
   m_pcPic->cs->slice->startProcessingTimer();
 
   CodingStructure& cs = *m_pcPic->cs;
 
+  if( m_loopFilterRows.cs == &cs )
+  {
+    // the rows not yet filtered behind the reconstruction are filtered here
+    xStopLoopFilterRows();
+    m_loopFilterRows.numRowsReconstructed = m_loopFilterRows.numRows;
+    xFilterLoopFilterRows( m_loopFilterRows, LoopFilterRows::ALF );
+    m_loopFilterRows.cs = nullptr;
+    CS::setRefinedMotionField( cs );
+    cs.picture->setMotionFieldDone();
+    xMaskOtherSubPics( cs );
+  }
+  else
+  {
+    xApplyLoopFilters( cs );
+  }
+  if( cs.sps->getUseLmcs() && cs.picHeader->getLmcsEnabledFlag() )
+  {
+    m_cReshaper.setRecReshaped( false );
+    m_cSAO.setReshaper( &m_cReshaper );
+  }
+
+  m_pcPic->cs->slice->stopProcessingTimer();
+}
+
+void DecLib::xLmcsInvMapCtuRow( CodingStructure& cs, std::vector<Pel>& lmcsInvLut, const int ctuRow )
+{
+  const PreCalcValues &pcv  = *cs.pcv;
+  const uint32_t       yPos = ctuRow * pcv.maxCUHeight;
+  for (uint32_t xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth)
+  {
+    const CodingUnit *cu = cs.getCU(Position(xPos, yPos), ChannelType::LUMA);
+    if (cu->slice->getLmcsEnabledFlag())
+    {
+      const uint32_t width  = (xPos + pcv.maxCUWidth > pcv.lumaWidth) ? (pcv.lumaWidth - xPos) : pcv.maxCUWidth;
+      const uint32_t height = (yPos + pcv.maxCUHeight > pcv.lumaHeight) ? (pcv.lumaHeight - yPos) : pcv.maxCUHeight;
+      const UnitArea area(cs.area.chromaFormat, Area(xPos, yPos, width, height));
+      cs.getRecoBuf(area).get(COMPONENT_Y).rspSignal(lmcsInvLut);
+    }
+  }
+}
+
+void DecLib::xApplyLoopFilters( CodingStructure& cs )
+{
   if (cs.sps->getUseLmcs() && cs.picHeader->getLmcsEnabledFlag())
   {
-    const PreCalcValues &pcv = *cs.pcv;
-    for (uint32_t yPos = 0; yPos < pcv.lumaHeight; yPos += pcv.maxCUHeight)
+    for (int ctuRow = 0; ctuRow < cs.pcv->heightInCtus; ctuRow++)
     {
-      for (uint32_t xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth)
-      {
-        const CodingUnit *cu = cs.getCU(Position(xPos, yPos), ChannelType::LUMA);
-        if (cu->slice->getLmcsEnabledFlag())
-        {
-          const uint32_t width  = (xPos + pcv.maxCUWidth > pcv.lumaWidth) ? (pcv.lumaWidth - xPos) : pcv.maxCUWidth;
-          const uint32_t height = (yPos + pcv.maxCUHeight > pcv.lumaHeight) ? (pcv.lumaHeight - yPos) : pcv.maxCUHeight;
-          const UnitArea area(cs.area.chromaFormat, Area(xPos, yPos, width, height));
-          cs.getRecoBuf(area).get(COMPONENT_Y).rspSignal(m_cReshaper.getInvLUT());
-        }
-      }
+      xLmcsInvMapCtuRow(cs, m_cReshaper.getInvLUT(), ctuRow);
     }
-    m_cReshaper.setRecReshaped(false);
-    m_cSAO.setReshaper(&m_cReshaper);
   }
 #if GREEN_METADATA_SEI_ENABLED
   FeatureCounterStruct initValues;
@@ -777,7 +850,8 @@ void DecLib::executeLoopFilters()
 #endif
   // deblocking filter
   m_deblockingFilter.deblockingFilterPic( cs );
-  CS::setRefinedMotionField(cs);
+  CS::setRefinedMotionField( cs );
+  cs.picture->setMotionFieldDone();
   if( cs.sps->getSAOEnabledFlag() )
   {
     m_cSAO.SAOProcess( cs, cs.picture->getSAO() );
@@ -797,6 +871,11 @@ void DecLib::executeLoopFilters()
   m_featureCounter.addALF(cs.m_featureCounter);
   m_featureCounter.addBoundaryStrengths(cs.m_featureCounter);
 #endif
+  xMaskOtherSubPics( cs );
+}
+
+void DecLib::xMaskOtherSubPics( CodingStructure& cs )
+{
   for (int i = 0; i < cs.pps->getNumSubPics() && m_targetSubPicIdx; i++)
   {
     // keep target subpic samples untouched, for other subpics mask their output sample value to 0
@@ -820,12 +899,327 @@ void DecLib::executeLoopFilters()
       }
     }
   }
+}
 
-  m_pcPic->cs->slice->stopProcessingTimer();
+void DecLib::xInitLoopFilterRows( LoopFilterRows& rows, CodingStructure& cs, DeblockingFilter& deblockingFilter, SampleAdaptiveOffset& sao, AdaptiveLoopFilter& alf )
+{
+  rows.cs               = &cs;
+  rows.deblockingFilter = &deblockingFilter;
+  rows.sao              = &sao;
+  rows.alf              = &alf;
+  rows.lmcsInvLut.clear();
+  rows.stageEnabled[LoopFilterRows::DEBLOCKING] = true;
+  rows.stageEnabled[LoopFilterRows::SAO]        = cs.sps->getSAOEnabledFlag();
+  rows.stageEnabled[LoopFilterRows::ALF]        = cs.sps->getALFEnabledFlag();
+  rows.publishRows          = false;
+  rows.lastAlfSlice         = nullptr;
+  rows.numRows              = cs.pcv->heightInCtus;
+  rows.numRowsReconstructed = 0;
+  rows.numCtusReconstructed.assign( rows.numRows, 0 );
+  std::fill_n( rows.numRowsDone, (int) LoopFilterRows::NUM_STAGES, 0 );
+  std::fill_n( rows.stageBusy, (int) LoopFilterRows::NUM_STAGES, false );
+  rows.stopped = false;
+}
+
+bool DecLib::xLoopFilterRowReady( const LoopFilterRows& rows, const int stage ) const
+{
+  // a stage may modify the last lines of the row above and reads the first lines of the row below, so it trails
+  // the previous stage by one row, while a disabled stage just passes the rows on
+  const int ctuRow    = rows.numRowsDone[stage];
+  const int numInput  = stage == LoopFilterRows::DEBLOCKING ? rows.numRowsReconstructed : rows.numRowsDone[stage - 1];
+  const int rowsAhead = rows.stageEnabled[stage] ? 2 : 1;
+  return ctuRow < rows.numRows && numInput >= std::min( ctuRow + rowsAhead, rows.numRows );
+}
+
+void DecLib::xFilterLoopFilterRow( LoopFilterRows& rows, const int stage, const int ctuRow )
+{
+  if( !rows.stageEnabled[stage] )
+  {
+    return;
+  }
+
+  CodingStructure& cs = *rows.cs;
+  // the parser may still add coding units to the picture, but does not move them while the row is filtered
+  std::shared_lock<std::shared_mutex> lock( cs.picture->unitStorageMutex );
+  switch( stage )
+  {
+  case LoopFilterRows::DEBLOCKING:
+    if( cs.sps->getUseLmcs() && cs.picHeader->getLmcsEnabledFlag() )
+    {
+      xLmcsInvMapCtuRow( cs, rows.lmcsInvLut, ctuRow );
+    }
+    rows.deblockingFilter->deblockingFilterCtuRow( cs, ctuRow );
+    break;
+  case LoopFilterRows::SAO:
+    rows.sao->SAOProcessCtuRow( cs, cs.picture->getSAO(), ctuRow );
+    break;
+  case LoopFilterRows::ALF:
+  {
+    Slice* lastSlice  = rows.alf->ALFProcessCtuRow( cs, ctuRow );
+    rows.lastAlfSlice = lastSlice != nullptr ? lastSlice : rows.lastAlfSlice;
+    break;
+  }
+  default:
+    THROW( "Invalid loop filter stage" );
+  }
+  if( stage == LoopFilterRows::ALF && rows.publishRows )
+  {
+    cs.picture->setCtuRowsDone( ctuRow + 1 );
+  }
+}
+
+void DecLib::xFilterLoopFilterRows( LoopFilterRows& rows, const int lastStage )
+{
+  // round robin over the stages, so that a row is completely filtered while its samples are still cached
+  for( bool progress = true; progress; )
+  {
+    progress = false;
+    for( int stage = LoopFilterRows::DEBLOCKING; stage <= lastStage; stage++ )
+    {
+      if( xLoopFilterRowReady( rows, stage ) )
+      {
+        xFilterLoopFilterRow( rows, stage, rows.numRowsDone[stage] );
+        rows.numRowsDone[stage]++;
+        progress = true;
+      }
+    }
+  }
+
+  if( rows.numRowsDone[LoopFilterRows::ALF] == rows.numRows )
+  {
+    // leave the slice active that the picture level deblocking filter and ALF leave active
+    CodingStructure&    cs  = *rows.cs;
+    const PreCalcValues &pcv = *cs.pcv;
+    cs.slice = cs.getCU( Position( ( pcv.widthInCtus - 1 ) << pcv.maxCUWidthLog2, ( pcv.heightInCtus - 1 ) << pcv.maxCUHeightLog2 ), ChannelType::LUMA )->slice;
+    cs.slice = rows.lastAlfSlice != nullptr ? rows.lastAlfSlice : cs.slice;
+  }
+}
+
+void DecLib::xCtuReconstructed( const unsigned ctuRsAddr )
+{
+  LoopFilterRows& rows        = m_loopFilterRows;
+  const unsigned  widthInCtus = rows.cs->pcv->widthInCtus;
+
+  std::unique_lock<std::mutex> lock( rows.mutex );
+  if( ++rows.numCtusReconstructed[ctuRsAddr / widthInCtus] < (int) widthInCtus )
+  {
+    return;
+  }
+  const int numRowsReconstructed = rows.numRowsReconstructed;
+  while( rows.numRowsReconstructed < rows.numRows
+         && rows.numCtusReconstructed[rows.numRowsReconstructed] >= (int) widthInCtus )
+  {
+    rows.numRowsReconstructed++;
+  }
+  if( rows.numRowsReconstructed > numRowsReconstructed )
+  {
+    xScheduleLoopFilterRows();
+  }
+}
+
+void DecLib::xScheduleLoopFilterRows()
+{
+  // called with the mutex of the rows held, each stage is run by at most one task, which takes the rows in order
+  LoopFilterRows& rows = m_loopFilterRows;
+  for( int stage = LoopFilterRows::DEBLOCKING; stage < LoopFilterRows::NUM_STAGES && !rows.stopped; stage++ )
+  {
+    if( !rows.stageEnabled[stage] )
+    {
+      while( xLoopFilterRowReady( rows, stage ) )
+      {
+        rows.numRowsDone[stage]++;
+      }
+    }
+    else if( !rows.stageBusy[stage] && xLoopFilterRowReady( rows, stage ) )
+    {
+      rows.stageBusy[stage] = true;
+      m_threadPool->addTask(
+        [this, stage]( int )
+        {
+          LoopFilterRows&              rows = m_loopFilterRows;
+          std::unique_lock<std::mutex> lock( rows.mutex );
+          while( !rows.stopped && xLoopFilterRowReady( rows, stage ) )
+          {
+            const int ctuRow = rows.numRowsDone[stage];
+            lock.unlock();
+            xFilterLoopFilterRow( rows, stage, ctuRow );
+            lock.lock();
+            rows.numRowsDone[stage]++;
+            xScheduleLoopFilterRows();
+          }
+          rows.stageBusy[stage] = false;
+        },
+        &rows.counter );
+    }
+  }
+}
+
+void DecLib::xStopLoopFilterRows()
+{
+  {
+    std::unique_lock<std::mutex> lock( m_loopFilterRows.mutex );
+    m_loopFilterRows.stopped = true;
+  }
+  m_loopFilterRows.counter.wait();
+}
+
+bool DecLib::isFrameParallelDecoding() const
+{
+#if ENABLE_TRACING || JVET_J0090_MEMORY_BANDWITH_MEASURE || GREEN_METADATA_SEI_ENABLED
+  return false;   // the trace context, the cache model and the feature counters are only updated by the main thread
+#else
+  return m_frameParallelDecoding && m_threadPool != nullptr;
+#endif
+}
+
+void DecLib::waitForLoopFilterJob()
+{
+  // rows left unfiltered by the pool are filtered by executeLoopFilters()
+  xStopLoopFilterRows();
+
+  LoopFilterJob& job = m_loopFilterJob;
+  if( job.pic != nullptr )
+  {
+    Picture& pic = *job.pic;
+    job.pic      = nullptr;
+    job.counter.wait();
+
+    // the coding units go back to the pools shared with the parser, so they are released by the main thread
+    pic.cs->destroyTemporaryCsData();
+
+    // the PPS copy is released with the next job, so let the picture refer to the active PPS again
+    pic.cs->pps = job.activePps;
+    pic.cs->pcv = job.activePps->pcv;
+    for( Slice* slice: pic.slices )
+    {
+      slice->setPPS( job.activePps );
+    }
+  }
+}
+
+void DecLib::xStartLoopFilterJob( MsgLevel msgl )
+{
+  waitForLoopFilterJob();
+
+  LoopFilterJob&   job = m_loopFilterJob;
+  Picture&         pic = *m_pcPic;
+  CodingStructure& cs  = *pic.cs;
+  const SPS&       sps = *cs.sps;
+  const PPS&       pps = *cs.pps;
+
+  // the main thread reuses the picture header, re-derives the PPS partitioning when parsing the next picture header
+  // and may replace the PPS derived values and the APSs while the next picture is decoded, so the job works on its
+  // own copies
+  job.picHeader = *cs.picHeader;
+  job.activePps = cs.pps;
+  job.pps       = std::make_unique<PPS>( pps );
+  job.pps->pcv  = new PreCalcValues( *cs.pcv );
+  cs.picHeader  = &job.picHeader;
+  cs.pps        = job.pps.get();
+  cs.pcv        = job.pps->pcv;
+
+  APS* alfApss[ALF_CTB_MAX_NUM_APS];
+  for( int i = 0; i < ALF_CTB_MAX_NUM_APS; i++ )
+  {
+    const APS* aps = cs.alfApss[i];
+    for( Slice* slice: pic.slices )
+    {
+      aps = slice->getAlfAPSs()[i] != nullptr ? slice->getAlfAPSs()[i] : aps;
+    }
+    if( aps != nullptr )
+    {
+      job.alfApss[i] = *aps;
+    }
+    alfApss[i] = aps != nullptr ? &job.alfApss[i] : nullptr;
+  }
+  memcpy( cs.alfApss, alfApss, sizeof( cs.alfApss ) );
+  for( Slice* slice: pic.slices )
+  {
+    slice->setPicHeader( &job.picHeader );
+    slice->setPPS( job.pps.get() );
+    slice->setAlfAPSs( alfApss );
+  }
+
+  const int      maxDepth                 = floorLog2( sps.getMaxCUWidth() ) - job.pps->pcv->minCUWidthLog2;
+  const uint32_t log2SaoOffsetScaleLuma   = (uint32_t) std::max( 0, sps.getBitDepth( ChannelType::LUMA ) - MAX_SAO_TRUNCATED_BITDEPTH );
+  const uint32_t log2SaoOffsetScaleChroma = (uint32_t) std::max( 0, sps.getBitDepth( ChannelType::CHROMA ) - MAX_SAO_TRUNCATED_BITDEPTH );
+  job.sao.create( pps.getPicWidthInLumaSamples(), pps.getPicHeightInLumaSamples(), sps.getChromaFormatIdc(), sps.getMaxCUWidth(),
+                  sps.getMaxCUHeight(), maxDepth, log2SaoOffsetScaleLuma, log2SaoOffsetScaleChroma );
+  job.deblockingFilter.create( maxDepth );
+  if( sps.getALFEnabledFlag() )
+  {
+    const int alfMaxDepth = floorLog2( sps.getMaxCUWidth() ) - sps.getLog2MinCodingBlockSize();
+    job.alf.create( pps.getPicWidthInLumaSamples(), pps.getPicHeightInLumaSamples(), sps.getChromaFormatIdc(), sps.getMaxCUWidth(),
+                    sps.getMaxCUHeight(), alfMaxDepth, sps.getBitDepths() );
+    // the CC-ALF control indices have been parsed into the decoder's ALF object
+    for( ComponentID compId: { COMPONENT_Cb, COMPONENT_Cr } )
+    {
+      std::copy_n( m_cALF.getCcAlfControlIdc( compId ), job.pps->pcv->sizeInCtus, job.alf.getCcAlfControlIdc( compId ) );
+    }
+  }
+  xInitLoopFilterRows( job.rows, cs, job.deblockingFilter, job.sao, job.alf );
+  job.rows.numRowsReconstructed = job.rows.numRows;
+  job.rows.publishRows          = m_targetSubPicIdx == 0;   // otherwise samples are masked once all rows are filtered
+  if( sps.getUseLmcs() && job.picHeader.getLmcsEnabledFlag() )
+  {
+    job.rows.lmcsInvLut = m_cReshaper.getInvLUT();
+    m_cReshaper.setRecReshaped( false );
+  }
+
+  // the DMVR conditions depend on the reference picture marking, which is updated for the next picture
+  job.dmvrPus.clear();
+  for( CodingUnit* cu: cs.cus )
+  {
+    for( auto& pu: CU::traversePUs( *cu ) )
+    {
+      if( PU::checkDMVRCondition( pu ) )
+      {
+        job.dmvrPus.push_back( &pu );
+      }
+    }
+  }
+
+  job.pic        = &pic;
+  job.referenced = pic.referenced;
+  job.msgl       = msgl;
+
+  m_threadPool->addTask(
+    [this, &job, &pic]( int )
+    {
+      CodingStructure& cs = *pic.cs;
+      try
+      {
+        cs.slice->startProcessingTimer();
+        // the motion field is final after deblocking, the filtered rows are reported to pictures referencing this one
+        // as they are completed by ALF
+        xFilterLoopFilterRows( job.rows, LoopFilterRows::DEBLOCKING );
+        for( PredictionUnit* pu: job.dmvrPus )
+        {
+          PU::setRefinedMotionField( *pu );
+        }
+        pic.setMotionFieldDone();
+        xFilterLoopFilterRows( job.rows, LoopFilterRows::ALF );
+        xMaskOtherSubPics( cs );
+        cs.slice->stopProcessingTimer();
+
+        xReportDecodedPicture( pic, job.referenced, job.msgl );
+
+        pic.destroyTempBuffers();
+        pic.extendPicBorder( cs.sps, cs.pps );
+      }
+      catch( ... )
+      {
+        pic.setDecodingFinished();   // do not leave pictures waiting on this one blocked
+        throw;
+      }
+      pic.setDecodingFinished();
+    },
+    &job.counter );
 }
 
 void DecLib::applyNnPostFilter()
 {
+  waitForLoopFilterJob();
   if(m_cListPic.empty())
   {
     return;
@@ -888,9 +1282,97 @@ void DecLib::finishPicture(int &poc, PicList *&rpcListPic, MsgLevel msgl, bool a
   m_featureCounter.height = m_pcPic->Y().height;
   m_featureCounter.width = m_pcPic->Y().width;
 #endif
-  
+
+  if( isFrameParallelDecoding() )
+  {
+    // loop filtering, reporting and border extension continue in the background
+    xStartLoopFilterJob( msgl );
+  }
+  else
+  {
+    xReportDecodedPicture( *m_pcPic, m_pcPic->referenced, msgl );
+  }
+
+  m_pcPic->neededForOutput = (pcSlice->getPicHeader()->getPicOutputFlag() ? true : false);
+  if (associatedWithNewClvs && m_pcPic->neededForOutput)
+  {
+    if (!pcSlice->getPPS()->getMixedNaluTypesInPicFlag() && pcSlice->getNalUnitType() == NAL_UNIT_CODED_SLICE_RASL)
+    {
+      m_pcPic->neededForOutput = false;
+    }
+    else if (pcSlice->getPPS()->getMixedNaluTypesInPicFlag())
+    {
+      bool isRaslPic = true;
+      for (int i = 0; isRaslPic && i < m_pcPic->numSlices; i++)
+      {
+        if (!(pcSlice->getNalUnitType() == NAL_UNIT_CODED_SLICE_RASL || pcSlice->getNalUnitType() == NAL_UNIT_CODED_SLICE_RADL))
+        {
+          isRaslPic = false;
+        }
+      }
+      if (isRaslPic)
+      {
+        m_pcPic->neededForOutput = false;
+      }
+    }
+  }
+
+  const VPS *vps = pcSlice->getVPS();
+  if (vps != nullptr)
+  {
+    if (!vps->getEachLayerIsAnOlsFlag())
+    {
+      const int layerId        = pcSlice->getNalUnitLayerId();
+      const int generalLayerId = vps->getGeneralLayerIdx(layerId);
+      bool      layerIsOutput  = true;
+
+      if (vps->getOlsModeIdc() == 0)
+      {
+        layerIsOutput = generalLayerId == vps->m_targetOlsIdx;
+      }
+      else if (vps->getOlsModeIdc() == 1)
+      {
+        layerIsOutput = generalLayerId <= vps->m_targetOlsIdx;
+      }
+      else if (vps->getOlsModeIdc() == 2)
+      {
+        layerIsOutput = vps->getOlsOutputLayerFlag(vps->m_targetOlsIdx, generalLayerId);
+      }
+      if (!layerIsOutput)
+      {
+        m_pcPic->neededForOutput = false;
+      }
+    }
+  }
+  m_pcPic->reconstructed = true;
+
+  // process buffered suffix APS NALUs
+  processSuffixApsNalus();
+
+  Slice::sortPicList( m_cListPic ); // sorting for application output
+  poc                 = pcSlice->getPOC();
+  rpcListPic          = &m_cListPic;
+  m_bFirstSliceInPicture  = true; // TODO: immer true? hier ist irgendwas faul
+  m_maxDecSubPicIdx = 0;
+  m_maxDecSliceAddrInSubPic = -1;
+
+  if( !isFrameParallelDecoding() )
+  {
+    m_pcPic->destroyTempBuffers();
+    m_pcPic->cs->destroyTemporaryCsData();
+  }
+#if !GDR_ENABLED
+  m_picHeader.initPicHeader();
+#endif
+  m_puCounter++;
+}
+
+void DecLib::xReportDecodedPicture( Picture& pic, const bool referenced, MsgLevel msgl )
+{
+  const Slice* pcSlice = pic.cs->slice;
+
   char c = (pcSlice->isIntra() ? 'I' : pcSlice->isInterP() ? 'P' : 'B');
-  if (!m_pcPic->referenced)
+  if (!referenced)
   {
     c += 32;  // tolower
   }
@@ -954,16 +1436,16 @@ void DecLib::finishPicture(int &poc, PicList *&rpcListPic, MsgLevel msgl, bool a
   }
   if (m_decodedPictureHashSEIEnabled)
   {
-    SEIMessages                  pictureHashes = getSeisByType(m_pcPic->SEIs, SEI::PayloadType::DECODED_PICTURE_HASH);
+    SEIMessages                  pictureHashes = getSeisByType(pic.SEIs, SEI::PayloadType::DECODED_PICTURE_HASH);
     const SEIDecodedPictureHash *hash =
       (pictureHashes.size() > 0) ? (SEIDecodedPictureHash *) *(pictureHashes.begin()) : nullptr;
     if (pictureHashes.size() > 1)
     {
       msg( WARNING, "Warning: Got multiple decoded picture hash SEI messages. Using first.");
     }
-    m_numberOfChecksumErrorsDetected += calcAndPrintHashStatus(((const Picture*) m_pcPic)->getRecoBuf(), hash, pcSlice->getSPS()->getBitDepths(), msgl);
+    m_numberOfChecksumErrorsDetected += calcAndPrintHashStatus(((const Picture&) pic).getRecoBuf(), hash, pcSlice->getSPS()->getBitDepths(), msgl);
 
-    SEIMessages snList = getSeisByType(m_pcPic->SEIs, SEI::PayloadType::SCALABLE_NESTING);
+    SEIMessages snList = getSeisByType(pic.SEIs, SEI::PayloadType::SCALABLE_NESTING);
     for (auto& sei: snList)
     {
       auto sn = reinterpret_cast<SEIScalableNesting*>(sei);
@@ -976,7 +1458,7 @@ void DecLib::finishPicture(int &poc, PicList *&rpcListPic, MsgLevel msgl, bool a
         {
           const SubPic& subpic = pcSlice->getPPS()->getSubPic(subpicId);
           const UnitArea area = UnitArea(pcSlice->getSPS()->getChromaFormatIdc(), Area(subpic.getSubPicLeft(), subpic.getSubPicTop(), subpic.getSubPicWidthInLumaSample(), subpic.getSubPicHeightInLumaSample()));
-          PelUnitBuf recoBuf = m_pcPic->cs->getRecoBuf(area);
+          PelUnitBuf recoBuf = pic.cs->getRecoBuf(area);
           m_numberOfChecksumErrorsDetected += calcAndPrintHashStatus(
             recoBuf, reinterpret_cast<SEIDecodedPictureHash*>(decPicHash), pcSlice->getSPS()->getBitDepths(), msgl);
         }
@@ -991,76 +1473,6 @@ void DecLib::finishPicture(int &poc, PicList *&rpcListPic, MsgLevel msgl, bool a
   m_cacheModel.accumulateFrame();
   m_cacheModel.clear();
 #endif
-
-  m_pcPic->neededForOutput = (pcSlice->getPicHeader()->getPicOutputFlag() ? true : false);
-  if (associatedWithNewClvs && m_pcPic->neededForOutput)
-  {
-    if (!pcSlice->getPPS()->getMixedNaluTypesInPicFlag() && pcSlice->getNalUnitType() == NAL_UNIT_CODED_SLICE_RASL)
-    {
-      m_pcPic->neededForOutput = false;
-    }
-    else if (pcSlice->getPPS()->getMixedNaluTypesInPicFlag())
-    {
-      bool isRaslPic = true;
-      for (int i = 0; isRaslPic && i < m_pcPic->numSlices; i++)
-      {
-        if (!(pcSlice->getNalUnitType() == NAL_UNIT_CODED_SLICE_RASL || pcSlice->getNalUnitType() == NAL_UNIT_CODED_SLICE_RADL))
-        {
-          isRaslPic = false;
-        }
-      }
-      if (isRaslPic)
-      {
-        m_pcPic->neededForOutput = false;
-      }
-    }
-  }
-
-  const VPS *vps = pcSlice->getVPS();
-  if (vps != nullptr)
-  {
-    if (!vps->getEachLayerIsAnOlsFlag())
-    {
-      const int layerId        = pcSlice->getNalUnitLayerId();
-      const int generalLayerId = vps->getGeneralLayerIdx(layerId);
-      bool      layerIsOutput  = true;
-
-      if (vps->getOlsModeIdc() == 0)
-      {
-        layerIsOutput = generalLayerId == vps->m_targetOlsIdx;
-      }
-      else if (vps->getOlsModeIdc() == 1)
-      {
-        layerIsOutput = generalLayerId <= vps->m_targetOlsIdx;
-      }
-      else if (vps->getOlsModeIdc() == 2)
-      {
-        layerIsOutput = vps->getOlsOutputLayerFlag(vps->m_targetOlsIdx, generalLayerId);
-      }
-      if (!layerIsOutput)
-      {
-        m_pcPic->neededForOutput = false;
-      }
-    }
-  }
-  m_pcPic->reconstructed = true;
-
-  // process buffered suffix APS NALUs
-  processSuffixApsNalus();
-
-  Slice::sortPicList( m_cListPic ); // sorting for application output
-  poc                 = pcSlice->getPOC();
-  rpcListPic          = &m_cListPic;
-  m_bFirstSliceInPicture  = true; // TODO: immer true? hier ist irgendwas faul
-  m_maxDecSubPicIdx = 0;
-  m_maxDecSliceAddrInSubPic = -1;
-
-  m_pcPic->destroyTempBuffers();
-  m_pcPic->cs->destroyTemporaryCsData();
-#if !GDR_ENABLED
-  m_pcPic->cs->picHeader->initPicHeader();
-#endif
-  m_puCounter++;
 }
 
 void DecLib::checkNoOutputPriorPics (PicList* pcListPic)
@@ -1099,6 +1511,7 @@ void DecLib::xUpdateRasInit(Slice* slice)
 void DecLib::xCreateLostPicture( int iLostPoc, const int layerId )
 {
   msg( INFO, "\ninserting lost poc : %d\n",iLostPoc);
+  waitForLoopFilterJob();
   Picture *cFillPic = xGetNewPicBuffer( *( m_parameterSetManager.getFirstSPS() ), *( m_parameterSetManager.getFirstPPS() ), 0, layerId );
 
   CHECK( !cFillPic->slices.size(), "No slices in picture" );
@@ -1145,7 +1558,7 @@ void  DecLib::xCreateUnavailablePicture( const PPS *pps, const int iUnavailableP
   auto const sps = m_parameterSetManager.getSPS(pps->getSPSId());
   Picture* cFillPic = xGetNewPicBuffer( *sps, *pps, 0, layerId );
 
-  cFillPic->cs      = new CodingStructure(g_xuPool);
+  cFillPic->cs      = new CodingStructure(cFillPic->m_unitPool);
   cFillPic->cs->sps = sps;
   cFillPic->cs->pps = pps;
   cFillPic->cs->vps = m_parameterSetManager.getVPS(sps->getVPSId());
@@ -2086,6 +2499,10 @@ void DecLib::xActivateParameterSets( const InputNALUnit nalu )
   const int layerId = nalu.m_nuhLayerId;
   if (m_bFirstSliceInPicture)
   {
+    // a previous picture may have been left without executeLoopFilters()
+    xStopLoopFilterRows();
+    m_loopFilterRows.cs = nullptr;
+
     APS** apss = m_parameterSetManager.getAPSs();
     memset(apss, 0, sizeof(*apss) * ALF_CTB_MAX_NUM_APS);
     const PPS *pps = m_parameterSetManager.getPPS(m_picHeader.getPPSId()); // this is a temporary PPS object. Do not store this value
@@ -2161,6 +2578,10 @@ void DecLib::xActivateParameterSets( const InputNALUnit nalu )
 
     //  Get a new picture buffer. This will also set up m_pcPic, and therefore give us a SPS and PPS pointer that we can use.
     m_pcPic = xGetNewPicBuffer( *sps, *pps, m_apcSlicePilot->getTLayer(), layerId );
+    if( isFrameParallelDecoding() )
+    {
+      m_pcPic->resetDecodingProgress( sps->getMaxCUHeight() );
+    }
 
     m_pcPic->finalInit( vps, *sps, *pps, &m_picHeader, apss, lmcsAPS, scalinglistAPS );
 #if GDR_ENABLED
@@ -2174,7 +2595,8 @@ void DecLib::xActivateParameterSets( const InputNALUnit nalu )
                                          pps->getPicWidthInLumaSamples(), pps->getPicHeightInLumaSamples(),
                                          sps->getChromaFormatIdc(), sps->getBitDepth(ChannelType::LUMA));
     m_firstPictureInSequence = false;
-    m_pcPic->createTempBuffers( m_pcPic->cs->pps->pcv->maxCUWidth, false, false, true, false );
+    // CTUs reconstructed on worker threads need picture sized prediction and residual buffers
+    m_pcPic->createTempBuffers( m_pcPic->cs->pps->pcv->maxCUWidth, false, false, true, false, m_threadPool == nullptr );
     m_pcPic->cs->createTemporaryCsData((bool)m_pcPic->cs->sps->getPLTMode());
     m_pcPic->cs->initStructData();
 
@@ -2211,12 +2633,15 @@ void DecLib::xActivateParameterSets( const InputNALUnit nalu )
       (uint32_t) std::max(0, sps->getBitDepth(ChannelType::LUMA) - MAX_SAO_TRUNCATED_BITDEPTH);
     const uint32_t log2SaoOffsetScaleChroma =
       (uint32_t) std::max(0, sps->getBitDepth(ChannelType::CHROMA) - MAX_SAO_TRUNCATED_BITDEPTH);
-    m_cSAO.create( pps->getPicWidthInLumaSamples(), pps->getPicHeightInLumaSamples(),
-                   sps->getChromaFormatIdc(),
-                   sps->getMaxCUWidth(), sps->getMaxCUHeight(),
-                   maxDepth,
-                   log2SaoOffsetScaleLuma, log2SaoOffsetScaleChroma );
-    m_deblockingFilter.create(maxDepth);
+    if( !isFrameParallelDecoding() )   // otherwise the loop filter job has its own filters
+    {
+      m_cSAO.create( pps->getPicWidthInLumaSamples(), pps->getPicHeightInLumaSamples(),
+                     sps->getChromaFormatIdc(),
+                     sps->getMaxCUWidth(), sps->getMaxCUHeight(),
+                     maxDepth,
+                     log2SaoOffsetScaleLuma, log2SaoOffsetScaleChroma );
+      m_deblockingFilter.create(maxDepth);
+    }
     m_cIntraPred.init(sps->getChromaFormatIdc(), sps->getBitDepth(ChannelType::LUMA));
     m_cInterPred.init( &m_cRdCost, sps->getChromaFormatIdc(), sps->getMaxCUHeight() );
     if (sps->getUseLmcs())
@@ -2265,6 +2690,7 @@ void DecLib::xActivateParameterSets( const InputNALUnit nalu )
       m_cCuDecoder.initDecCuReshaper(&m_cReshaper, sps->getChromaFormatIdc());
     }
     m_cTrQuant.init(m_cTrQuantScalingList.getQuant(), sps->getMaxTbSize(), false, false, false, false);
+    m_cSliceDecoder.initReconWorkers(sps, &m_cTrQuant, &m_cReshaper);
 
     // RdCost
     m_cRdCost.setCostMode ( COST_STANDARD_LOSSY ); // not used in decoder side RdCost stuff -> set to default
@@ -2279,6 +2705,20 @@ void DecLib::xActivateParameterSets( const InputNALUnit nalu )
     }
     pSlice->m_ccAlfFilterControl[0] = m_cALF.getCcAlfControlIdc(COMPONENT_Cb);
     pSlice->m_ccAlfFilterControl[1] = m_cALF.getCcAlfControlIdc(COMPONENT_Cr);
+
+    // unless the picture is loop filtered in the background once decoded, the worker threads filter the CTU rows
+    // behind the reconstruction
+#if !( ENABLE_TRACING || JVET_J0090_MEMORY_BANDWITH_MEASURE || GREEN_METADATA_SEI_ENABLED )
+    if( m_threadPool != nullptr && !isFrameParallelDecoding() )
+    {
+      xInitLoopFilterRows( m_loopFilterRows, *m_pcPic->cs, m_deblockingFilter, m_cSAO, m_cALF );
+      m_cSliceDecoder.setCtuReconstructedCallback( [this]( unsigned ctuRsAddr ) { xCtuReconstructed( ctuRsAddr ); } );
+    }
+    else
+#endif
+    {
+      m_cSliceDecoder.setCtuReconstructedCallback( nullptr );
+    }
   }
   else
   {
@@ -2295,15 +2735,25 @@ void DecLib::xActivateParameterSets( const InputNALUnit nalu )
     APS *lmcsAPS = m_picHeader.getLmcsAPS();
     APS *scalinglistAPS = m_picHeader.getScalingListAPS();
 
-    // fix Parameter Sets, now that we have the real slice
+    // fix Parameter Sets, now that we have the real slice (only written when changed, as the in-loop filters may
+    // already be working on the rows decoded so far)
     m_pcPic->cs->slice = pSlice;
-    m_pcPic->cs->sps   = sps;
-    m_pcPic->cs->pps   = pps;
+    if( m_pcPic->cs->sps != sps )
+    {
+      m_pcPic->cs->sps = sps;
+    }
+    if( m_pcPic->cs->pps != pps )
+    {
+      m_pcPic->cs->pps = pps;
+    }
     memcpy(m_pcPic->cs->alfApss, apss, sizeof(m_pcPic->cs->alfApss));
     m_pcPic->cs->lmcsAps = lmcsAPS;
     m_pcPic->cs->scalinglistAps = scalinglistAPS;
 
-    m_pcPic->cs->pcv   = pps->pcv;
+    if( m_pcPic->cs->pcv != pps->pcv )
+    {
+      m_pcPic->cs->pcv = pps->pcv;
+    }
 
     // check that the current active PPS has not changed...
     if (m_parameterSetManager.getSPSChangedFlag(sps->getSPSId()) )
@@ -3669,6 +4119,11 @@ bool DecLib::xDecodeSlice(InputNALUnit &nalu, int &iSkipFrame, int iPOCLastDispl
 #if GREEN_METADATA_SEI_ENABLED
   pcSlice->setFeatureCounter(this->m_featureCounter);
 #endif
+  if( m_loopFilterRows.cs == m_pcPic->cs && pcSlice->getLmcsEnabledFlag() && m_loopFilterRows.lmcsInvLut.empty() )
+  {
+    // the rows are inverse mapped while the table is rebuilt for the next slices
+    m_loopFilterRows.lmcsInvLut = m_cReshaper.getInvLUT();
+  }
   //  Decode a picture
   m_cSliceDecoder.decompressSlice( pcSlice, &( nalu.getBitstream() ), ( m_pcPic->poc == getDebugPOC() ? getDebugCTU() : -1 ) );
 #if GREEN_METADATA_SEI_ENABLED
@@ -3789,6 +4244,10 @@ void DecLib::xDecodeSPS( InputNALUnit& nalu )
   sps->setLayerId( nalu.m_nuhLayerId );
   DTRACE( g_trace_ctx, D_QP_PER_CTU, "CTU Size: %dx%d", sps->getMaxCUWidth(), sps->getMaxCUHeight() );
   m_accessUnitSpsNumSubpic[nalu.m_nuhLayerId] = sps->getNumSubPics();
+  if( m_loopFilterJob.pic != nullptr && m_loopFilterJob.pic->cs->sps->getSPSId() == sps->getSPSId() )
+  {
+    waitForLoopFilterJob();   // the picture filtered in the background still uses the SPS that may get replaced
+  }
   m_parameterSetManager.storeSPS( sps, nalu.getBitstream().getFifo() );
 }
 
@@ -3800,6 +4259,10 @@ void DecLib::xDecodePPS( InputNALUnit& nalu )
   pps->setLayerId( nalu.m_nuhLayerId );
   pps->setTemporalId( nalu.m_temporalId );
   pps->setPuCounter( m_puCounter );
+  if( m_loopFilterJob.pic != nullptr && m_loopFilterJob.pic->cs->pps->getPPSId() == pps->getPPSId() )
+  {
+    waitForLoopFilterJob();   // the picture filtered in the background still uses the PPS that may get replaced
+  }
   m_parameterSetManager.storePPS( pps, nalu.getBitstream().getFifo() );
 }
 
@@ -4205,7 +4668,7 @@ uint32_t DecLib::xGetNnpfaTargetId(uint8_t* payload, uint32_t payloadSize)
 /**
 - lookahead through next NAL units to determine if current NAL unit is the first NAL unit in a new picture
 */
-bool DecLib::isNewPicture(std::ifstream *bitstreamFile, class InputByteStream *bytestream)
+bool DecLib::isNewPicture(std::istream *bitstreamFile, class InputByteStream *bytestream)
 {
   bool ret = false;
   bool finished = false;
@@ -4219,10 +4682,8 @@ bool DecLib::isNewPicture(std::ifstream *bitstreamFile, class InputByteStream *b
   // save stream position for backup
 #if RExt__DECODER_DEBUG_STATISTICS
   CodingStatistics::CodingStatisticsData* backupStats = new CodingStatistics::CodingStatisticsData(CodingStatistics::GetStatistics());
-  std::streampos location = bitstreamFile->tellg() - std::streampos(bytestream->getNumBufferedBytes());
-#else
-  std::streampos location = bitstreamFile->tellg();
 #endif
+  bytestream->startLookahead();
 
   // look ahead until picture start location is determined
   while (!finished && !!(*bitstreamFile))
@@ -4294,17 +4755,12 @@ bool DecLib::isNewPicture(std::ifstream *bitstreamFile, class InputByteStream *b
     }
   }
 
-  // restore previous stream location - minus 3 due to the need for the annexB parser to read three extra bytes
-#if RExt__DECODER_DEBUG_BIT_STATISTICS
+  // restore previous stream position
   bitstreamFile->clear();
-  bitstreamFile->seekg(location);
-  bytestream->reset();
+  bytestream->endLookahead();
+#if RExt__DECODER_DEBUG_BIT_STATISTICS
   CodingStatistics::SetStatistics(*backupStats);
   delete backupStats;
-#else
-  bitstreamFile->clear();
-  bitstreamFile->seekg(location-std::streamoff(3));
-  bytestream->reset();
 #endif
 
   // return TRUE if next NAL unit is the start of a new picture
@@ -4314,7 +4770,7 @@ bool DecLib::isNewPicture(std::ifstream *bitstreamFile, class InputByteStream *b
 /**
 - lookahead through next NAL units to determine if current NAL unit is the first NAL unit in a new access unit
 */
-bool DecLib::isNewAccessUnit( bool newPicture, std::ifstream *bitstreamFile, class InputByteStream *bytestream )
+bool DecLib::isNewAccessUnit( bool newPicture, std::istream *bitstreamFile, class InputByteStream *bytestream )
 {
   bool ret = false;
   bool finished = false;
@@ -4328,10 +4784,8 @@ bool DecLib::isNewAccessUnit( bool newPicture, std::ifstream *bitstreamFile, cla
   // save stream position for backup
 #if RExt__DECODER_DEBUG_STATISTICS
   CodingStatistics::CodingStatisticsData* backupStats = new CodingStatistics::CodingStatisticsData(CodingStatistics::GetStatistics());
-  std::streampos location = bitstreamFile->tellg() - std::streampos(bytestream->getNumBufferedBytes());
-#else
-  std::streampos location = bitstreamFile->tellg();
 #endif
+  bytestream->startLookahead();
 
   // look ahead until access unit start location is determined
   while (!finished && !!(*bitstreamFile))
@@ -4385,17 +4839,12 @@ bool DecLib::isNewAccessUnit( bool newPicture, std::ifstream *bitstreamFile, cla
     }
   }
 
-  // restore previous stream location
-#if RExt__DECODER_DEBUG_BIT_STATISTICS
+  // restore previous stream position
   bitstreamFile->clear();
-  bitstreamFile->seekg(location);
-  bytestream->reset();
+  bytestream->endLookahead();
+#if RExt__DECODER_DEBUG_BIT_STATISTICS
   CodingStatistics::SetStatistics(*backupStats);
   delete backupStats;
-#else
-  bitstreamFile->clear();
-  bitstreamFile->seekg(location);
-  bytestream->reset();
 #endif
 
   // return TRUE if next NAL unit is the start of a new picture
@@ -181,6 +181,58 @@ private:
   bool                                m_ShutterFilterEnable;          ///< enable Post-processing with Shutter Interval SEI
   int                     m_debugPOC;
   int                     m_debugCTU;
+  ThreadPool*             m_threadPool;                   ///< worker threads of the parallel decoding stages, nullptr if single-threaded
+  bool                    m_frameParallelDecoding;        ///< loop filter a picture on a worker thread while the next one is decoded
+
+  /// in-loop filtering of a picture CTU row by CTU row: a row is deblocked (after the LMCS inverse mapping) once the
+  /// row below is reconstructed, SAO and ALF of a row follow once the previous stage has completed the row below
+  struct LoopFilterRows
+  {
+    enum Stage
+    {
+      DEBLOCKING,
+      SAO,
+      ALF,
+      NUM_STAGES
+    };
+    CodingStructure*        cs                = nullptr;
+    DeblockingFilter*       deblockingFilter  = nullptr;
+    SampleAdaptiveOffset*   sao               = nullptr;
+    AdaptiveLoopFilter*     alf               = nullptr;
+    std::vector<Pel>        lmcsInvLut;
+    bool                    stageEnabled[NUM_STAGES] = {};
+    bool                    publishRows       = false;   ///< report the filtered rows to the pictures referencing this one
+    Slice*                  lastAlfSlice      = nullptr; ///< last slice whose ALF parameters have been loaded
+    std::mutex              mutex;                       ///< guards the progress below while the stages run on the pool
+    std::vector<int>        numCtusReconstructed;        ///< per CTU row
+    int                     numRows           = 0;
+    int                     numRowsReconstructed = 0;    ///< complete rows from the top of the picture
+    int                     numRowsDone[NUM_STAGES] = {};
+    bool                    stageBusy[NUM_STAGES]   = {};
+    bool                    stopped           = false;   ///< no more stage tasks are started
+    WaitCounter             counter;
+  };
+  LoopFilterRows          m_loopFilterRows;               ///< filters the picture being decoded behind its reconstruction
+
+  /// loop filtering of a decoded picture running on a worker thread, owns everything the main thread may
+  /// replace or reuse for the next picture in the meantime
+  struct LoopFilterJob
+  {
+    Picture*                       pic        = nullptr;
+    bool                           referenced = false;
+    MsgLevel                       msgl       = INFO;
+    DeblockingFilter               deblockingFilter;
+    SampleAdaptiveOffset           sao;
+    AdaptiveLoopFilter             alf;
+    LoopFilterRows                 rows;
+    std::vector<PredictionUnit*>   dmvrPus;
+    PicHeader                      picHeader;
+    const PPS*                     activePps  = nullptr;
+    std::unique_ptr<PPS>           pps;
+    APS                            alfApss[ALF_CTB_MAX_NUM_APS];
+    WaitCounter                    counter;
+  };
+  LoopFilterJob           m_loopFilterJob;
 
   struct AccessUnitInfo
   {
@@ -317,6 +369,12 @@ public:
   void setDebugCTU( int debugCTU )        { m_debugCTU = debugCTU; }
   int  getDebugPOC( )               const { return m_debugPOC; };
   void setDebugPOC( int debugPOC )        { m_debugPOC = debugPOC; };
+  void setNumThreads( int numThreads );
+  void setFrameParallelDecoding( bool enable )  { m_frameParallelDecoding = enable; }
+  bool isFrameParallelDecoding() const;
+  void setDecoupledParsing( bool enable )       { m_cSliceDecoder.setDecoupledParsing( enable ); }
+  /// blocks until the loop filtering running in the background (if any) has finished, rethrows its errors
+  void waitForLoopFilterJob();
   void resetAccessUnitNals()              { m_accessUnitNals.clear();    }
   void resetAccessUnitPicInfo()           { m_accessUnitPicInfo.clear(); }
   void resetAccessUnitApsNals()
@@ -358,8 +416,8 @@ public:
   }
 
   void  setAPSMapEnc(EnumArray<ParameterSetMap<APS>, ApsType> *apsMap) { m_apsMapEnc = apsMap; }
-  bool  isNewPicture( std::ifstream *bitstreamFile, class InputByteStream *bytestream );
-  bool  isNewAccessUnit( bool newPicture, std::ifstream *bitstreamFile, class InputByteStream *bytestream );
+  bool  isNewPicture( std::istream *bitstreamFile, class InputByteStream *bytestream );
+  bool  isNewAccessUnit( bool newPicture, std::istream *bitstreamFile, class InputByteStream *bytestream );
 
   bool      getHTidExternalSetFlag()               const { return m_mTidExternalSet; }
   void      setHTidExternalSetFlag(bool mTidExternalSet)  { m_mTidExternalSet = mTidExternalSet; }
@@ -400,6 +458,18 @@ protected:
   void  xUpdateRasInit(Slice* slice);
 
   Picture * xGetNewPicBuffer( const SPS &sps, const PPS &pps, const uint32_t temporalLayer, const int layerId );
+  void  xApplyLoopFilters( CodingStructure& cs );
+  void  xReportDecodedPicture( Picture& pic, const bool referenced, MsgLevel msgl );
+  void  xStartLoopFilterJob( MsgLevel msgl );
+  void  xInitLoopFilterRows( LoopFilterRows& rows, CodingStructure& cs, DeblockingFilter& deblockingFilter, SampleAdaptiveOffset& sao, AdaptiveLoopFilter& alf );
+  bool  xLoopFilterRowReady( const LoopFilterRows& rows, const int stage ) const;
+  void  xFilterLoopFilterRow( LoopFilterRows& rows, const int stage, const int ctuRow );
+  void  xFilterLoopFilterRows( LoopFilterRows& rows, const int lastStage );
+  void  xCtuReconstructed( const unsigned ctuRsAddr );
+  void  xScheduleLoopFilterRows();
+  void  xStopLoopFilterRows();
+  void  xLmcsInvMapCtuRow( CodingStructure& cs, std::vector<Pel>& lmcsInvLut, const int ctuRow );
+  void  xMaskOtherSubPics( CodingStructure& cs );
   void  xCreateLostPicture( int iLostPOC, const int layerId );
   void  xCreateUnavailablePicture( const PPS *pps, const int iUnavailablePoc, const bool longTermFlag, const int temporalId, const int layerId, const bool interLayerRefPicFlag );
   void  checkParameterSetsInclusionSEIconstraints(const InputNALUnit nalu);
@@ -49,11 +49,20 @@
 //////////////////////////////////////////////////////////////////////
 
 DecSlice::DecSlice()
+  : m_threadPool( nullptr )
+  , m_masterTrQuant( nullptr )
+  , m_masterReshaper( nullptr )
+  , m_numCtusParsed( 0 )
+  , m_numCtusReconstructed( 0 )
+  , m_reconAbort( false )
+  , m_maxCtusParsedAhead( 0 )
+  , m_decoupledParsing( false )
 {
 }
 
 DecSlice::~DecSlice()
 {
+  destroyReconWorkers();
 }
 
 void DecSlice::create()
@@ -62,6 +71,46 @@ void DecSlice::create()
 
 void DecSlice::destroy()
 {
+  destroyReconWorkers();
+}
+
+void DecSlice::initReconWorkers( const SPS* sps, TrQuant* trQuant, Reshape* reshaper )
+{
+  m_masterTrQuant  = trQuant;
+  m_masterReshaper = reshaper;
+
+  const int numWorkers = m_threadPool ? m_threadPool->getNumThreads() : 0;
+
+  while( (int) m_reconWorkers.size() < numWorkers )
+  {
+    m_reconWorkers.push_back( new CtuReconWorker );
+  }
+
+  const ChromaFormat chromaFormat = sps->getChromaFormatIdc();
+
+  for( auto worker: m_reconWorkers )
+  {
+    worker->intraPred.init( chromaFormat, sps->getBitDepth( ChannelType::LUMA ) );
+    worker->interPred.init( &worker->rdCost, chromaFormat, sps->getMaxCUHeight() );
+    worker->trQuant.init( trQuant->getQuant(), sps->getMaxTbSize(), false, false, false, false );
+    worker->rdCost.setCostMode( COST_STANDARD_LOSSY );
+    worker->cuDecoder.init( &worker->trQuant, &worker->intraPred, &worker->interPred );
+    if( sps->getUseLmcs() )
+    {
+      worker->cuDecoder.initDecCuReshaper( &worker->reshaper, chromaFormat );
+    }
+  }
+}
+
+void DecSlice::destroyReconWorkers()
+{
+  for( auto worker: m_reconWorkers )
+  {
+    worker->cuDecoder.destoryDecCuReshaprBuf();
+    worker->reshaper.destroy();
+    delete worker;
+  }
+  m_reconWorkers.clear();
 }
 
 void DecSlice::init( CABACDecoder* cabacDecoder, DecCu* pcCuDecoder )
@@ -82,14 +131,24 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
   // setup coding structure
   CodingStructure& cs = *pic->cs;
   cs.slice            = slice;
-  cs.sps              = sps;
-  cs.pps              = slice->getPPS();
+  // only written when changed, as the in-loop filters may already be working on the rows above
+  if( cs.sps != sps )
+  {
+    cs.sps = sps;
+  }
+  if( cs.pps != slice->getPPS() )
+  {
+    cs.pps = slice->getPPS();
+  }
   memcpy(cs.alfApss, slice->getAlfAPSs(), sizeof(cs.alfApss));
 
   cs.lmcsAps          = slice->getPicHeader()->getLmcsAPS();
   cs.scalinglistAps   = slice->getPicHeader()->getScalingListAPS();
 
-  cs.pcv              = slice->getPPS()->pcv;
+  if( cs.pcv != slice->getPPS()->pcv )
+  {
+    cs.pcv = slice->getPPS()->pcv;
+  }
   cs.chromaQpAdj      = 0;
 
   cs.picture->resizeSAO(cs.pcv->sizeInCtus, 0);
@@ -133,6 +192,64 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
   {
     clipMv = clipMvInPic;
   }
+
+  const bool parallelRecon = xUseParallelRecon( slice, debugCTU );
+
+  // a CU, PU and TU per luma and per chroma 4x4 unit of a CTU
+  const size_t maxUnitsPerCtu = 2 * ( sps->getMaxCUWidth() >> MIN_CU_LOG2 ) * ( sps->getMaxCUHeight() >> MIN_CU_LOG2 );
+
+  // waits for all outstanding CTU reconstructions when leaving the slice, also when the parser throws
+  struct ReconGuard
+  {
+    DecSlice *sliceDecoder;
+    bool      active;
+    ~ReconGuard()
+    {
+      if( active )
+      {
+        {
+          std::unique_lock<std::mutex> lock( sliceDecoder->m_reconMutex );
+          sliceDecoder->m_reconAbort = true;
+        }
+        sliceDecoder->m_reconCond.notify_all();
+        try
+        {
+          sliceDecoder->m_reconCounter.wait();
+        }
+        catch( ... )
+        {
+        }
+      }
+    }
+  } reconGuard = { this, parallelRecon };
+
+  if( parallelRecon )
+  {
+    // per CTU copies of the HMVP tables, as CTU lines are reconstructed concurrently
+    cs.ctuMotionLut.resize( cs.pcv->sizeInCtus );
+
+    m_ctuReconDone.assign( cs.pcv->sizeInCtus, 1 );
+    for( unsigned ctuIdx = 0; ctuIdx < slice->getNumCtuInSlice(); ctuIdx++ )
+    {
+      m_ctuReconDone[slice->getCtuAddrInSlice( ctuIdx )] = 0;
+    }
+    m_numCtusParsed        = 0;
+    m_numCtusReconstructed = 0;
+    m_reconAbort           = false;
+    // the parser stays at most a CTU line per worker ahead of the reconstruction, which bounds the parsed but not
+    // yet reconstructed CTUs; a full CTU line must fit, so that the oldest unfinished line can always be completed
+    m_maxCtusParsedAhead   = unsigned( m_reconWorkers.size() + 1 ) * widthInCtus;
+
+    for( auto worker: m_reconWorkers )
+    {
+      worker->trQuant.getQuant()->setUseScalingList( m_masterTrQuant->getQuant()->getUseScalingList() );
+      if( sps->getUseLmcs() )
+      {
+        worker->reshaper = *m_masterReshaper;
+      }
+    }
+  }
+
   // for every CTU in the slice segment...
   unsigned subStrmId = 0;
   for( unsigned ctuIdx = 0; ctuIdx < slice->getNumCtuInSlice(); ctuIdx++ )
@@ -167,6 +284,7 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
 
           if( !refPic->getSubPicSaved() && refPic->subPictures.size() > 1 )
           {
+            refPic->waitForDecodingFinished();   // may still be loop filtered in the background
             refPic->saveSubPicBorder(refPic->getPOC(), subPicX, subPicY, subPicWidth, subPicHeight);
             refPic->extendSubPicBorder(refPic->getPOC(), subPicX, subPicY, subPicWidth, subPicHeight);
             refPic->setSubPicSaved(true);
@@ -209,13 +327,7 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
       pic->m_prevQP.fill(slice->getSliceQp());
     }
 
-    bool updateBcwCodingOrder = cs.slice->getSliceType() == B_SLICE && ctuIdx == 0;
-    if(updateBcwCodingOrder)
-    {
-      resetBcwCodingOrder(true, cs);
-    }
-
-    if ((cs.slice->getSliceType() != I_SLICE || cs.sps->getIBCFlag()) && ctuXPosInCtus == tileXPosInCtus)
+    if ((cs.slice->getSliceType() != I_SLICE || cs.sps->getIBCFlag()) && ctuXPosInCtus == tileXPosInCtus && !parallelRecon)
     {
       cs.motionLut.lut.resize(0);
       cs.motionLut.lutIbc.resize(0);
@@ -231,9 +343,50 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
     {
       break;
     }
+    if( parallelRecon || m_ctuReconstructed )
+    {
+      if( cs.cus.capacity() - cs.cus.size() < maxUnitsPerCtu || cs.pus.capacity() - cs.pus.size() < maxUnitsPerCtu
+          || cs.tus.capacity() - cs.tus.size() < maxUnitsPerCtu )
+      {
+        // growing the unit vectors moves them, so no CTU may be under reconstruction or in-loop filtering meanwhile
+        if( parallelRecon )
+        {
+          xWaitCtuRecon();
+        }
+        std::unique_lock<std::shared_mutex> lock( pic->unitStorageMutex );
+        const size_t numUnits  = std::max( { cs.cus.size(), cs.pus.size(), cs.tus.size() } );
+        const size_t allocSize = 2 * numUnits + maxUnitsPerCtu * cs.pcv->widthInCtus;
+        cs.cus.reserve( allocSize );
+        cs.pus.reserve( allocSize );
+        cs.tus.reserve( allocSize );
+      }
+    }
+    if( parallelRecon )
+    {
+      xWaitCtuRecon( m_maxCtusParsedAhead - 1 );
+      if( ctuXPosInCtus == tileXPosInCtus )
+      {
+        const unsigned numCtusInLine = std::min( tileColWidth, slice->getNumCtuInSlice() - ctuIdx );
+        m_threadPool->addTask( [this, slice, ctuIdx, numCtusInLine]( int threadIdx )
+                               { xReconstructCtuLine( slice, ctuIdx, numCtusInLine, threadIdx ); },
+                               &m_reconCounter );
+      }
+    }
+
     cabacReader.coding_tree_unit( cs, ctuArea, pic->m_prevQP, ctuRsAddr );
 
-    m_pcCuDecoder->decompressCtu( cs, ctuArea );
+    if( parallelRecon )
+    {
+      xCtuParsed();
+    }
+    else
+    {
+      m_pcCuDecoder->decompressCtu( cs, ctuArea );
+      if( m_ctuReconstructed )
+      {
+        m_ctuReconstructed( ctuRsAddr );
+      }
+    }
 #if GREEN_METADATA_SEI_ENABLED
     FeatureCounterStruct featureCounter = slice->getFeatureCounter();
     countFeatures( featureCounter, cs,ctuArea);
@@ -270,6 +423,13 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
         subStrmId++;
       }
     }
+    if( parallelRecon && ctuIdx == slice->getNumCtuInSlice() - 1 )
+    {
+      // the reference picture borders below may only be restored once all CTUs are reconstructed
+      reconGuard.active = false;
+      m_reconCounter.wait();
+      cs.ctuMotionLut.clear();
+    }
     if (slice->getPPS()->getNumSubPics() >= 2 && curSubPic.getTreatedAsPicFlag() && ctuIdx == (slice->getNumCtuInSlice() - 1))
     // for last Ctu in the slice
     {
@@ -334,4 +494,145 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
   slice->stopProcessingTimer();
 }
 
+bool DecSlice::xUseParallelRecon( const Slice* slice, int debugCTU ) const
+{
+#if ENABLE_TRACING || JVET_J0090_MEMORY_BANDWITH_MEASURE || GREEN_METADATA_SEI_ENABLED
+  // tracing, bandwidth measurement and feature counting rely on the CTU order of the single-threaded decoder
+  return false;
+#else
+  if( m_reconWorkers.empty() || debugCTU >= 0 )
+  {
+    return false;
+  }
+
+  const PPS      &pps         = *slice->getPPS();
+  const unsigned  firstCtu    = slice->getCtuAddrInSlice( 0 );
+  const unsigned  widthInCtus = pps.pcv->widthInCtus;
+
+  // pictures without wavefronts, tiles, subpictures or multiple slices stay on the single-threaded path, unless
+  // parsing and reconstruction are decoupled: the CTU lines are then reconstructed behind the parser all the same
+  const bool multipleSlices = slice->getNumCtuInSlice() < pps.pcv->sizeInCtus;
+  if( !slice->getSPS()->getEntropyCodingSyncEnabledFlag() && pps.getNumTiles() == 1 && pps.getNumSubPics() <= 1
+      && !multipleSlices )
+  {
+    return m_decoupledParsing;
+  }
+
+  // CTU lines start at the left tile boundary, which is where any slice starts
+  if( firstCtu % widthInCtus != pps.getTileColumnBd( pps.ctuToTileCol( firstCtu % widthInCtus ) ) )
+  {
+    return false;
+  }
+
+  // a single CTU line does not allow for any concurrency between the CTU lines, only between parsing and reconstruction
+  return m_decoupledParsing
+         || slice->getNumCtuInSlice() > pps.getTileColumnWidth( pps.ctuToTileCol( firstCtu % widthInCtus ) );
+#endif
+}
+
+void DecSlice::xCtuParsed()
+{
+  {
+    std::unique_lock<std::mutex> lock( m_reconMutex );
+    m_numCtusParsed++;
+  }
+  m_reconCond.notify_all();
+}
+
+void DecSlice::xWaitCtuRecon( unsigned maxCtusPending )
+{
+  bool abort = false;
+  {
+    std::unique_lock<std::mutex> lock( m_reconMutex );
+    m_reconCond.wait( lock, [&] { return m_reconAbort || m_numCtusParsed - m_numCtusReconstructed <= maxCtusPending; } );
+    abort = m_reconAbort;
+  }
+  if( abort )
+  {
+    // a reconstruction task failed, wait for the others to give up and rethrow its exception
+    m_reconCounter.wait();
+  }
+}
+
+void DecSlice::xReconstructCtuLine( const Slice* slice, unsigned startCtuIdx, unsigned numCtus, int threadIdx )
+{
+  CtuReconWorker  &worker = *m_reconWorkers[threadIdx];
+  CodingStructure &cs     = *slice->getPic()->cs;
+  const PPS       &pps    = *slice->getPPS();
+  const SPS       &sps    = *slice->getSPS();
+
+  const unsigned widthInCtus = cs.pcv->widthInCtus;
+  const unsigned maxCUSize   = sps.getMaxCUWidth();
+
+  try
+  {
+    if( slice->getSliceType() != I_SLICE || sps.getIBCFlag() )
+    {
+      worker.interPred.resetIBCBuffer( cs.pcv->chrFormat, sps.getMaxCUHeight() );
+    }
+
+    for( unsigned ctuIdx = startCtuIdx; ctuIdx < startCtuIdx + numCtus; ctuIdx++ )
+    {
+      const unsigned ctuRsAddr      = slice->getCtuAddrInSlice( ctuIdx );
+      const unsigned ctuXPosInCtus  = ctuRsAddr % widthInCtus;
+      const unsigned ctuYPosInCtus  = ctuRsAddr / widthInCtus;
+      const unsigned tileColIdx     = pps.ctuToTileCol( ctuXPosInCtus );
+      const unsigned tileXPosInCtus = pps.getTileColumnBd( tileColIdx );
+      const unsigned tileYPosInCtus = pps.getTileRowBd( pps.ctuToTileRow( ctuYPosInCtus ) );
+      const unsigned tileColWidth   = pps.getTileColumnWidth( tileColIdx );
+
+      // intra prediction and motion vector prediction may reference the CTUs up to the above-right one
+      const bool     hasAbove     = ctuYPosInCtus > tileYPosInCtus;
+      const unsigned aboveRsAddr  = hasAbove ? ( ctuYPosInCtus - 1 ) * widthInCtus
+                                                 + std::min( ctuXPosInCtus + 1, tileXPosInCtus + tileColWidth - 1 )
+                                             : 0;
+      {
+        std::unique_lock<std::mutex> lock( m_reconMutex );
+        m_reconCond.wait( lock, [&] {
+          return m_reconAbort || ( m_numCtusParsed > ctuIdx && ( !hasAbove || m_ctuReconDone[aboveRsAddr] ) );
+        } );
+        if( m_reconAbort )
+        {
+          return;
+        }
+      }
+
+      LutMotionCand &motionLut = cs.ctuMotionLut[ctuRsAddr];
+      if( ctuXPosInCtus == tileXPosInCtus )
+      {
+        motionLut.lut.resize( 0 );
+        motionLut.lutIbc.resize( 0 );
+      }
+      else
+      {
+        motionLut = cs.ctuMotionLut[ctuRsAddr - 1];
+      }
+
+      const UnitArea ctuArea( cs.area.chromaFormat,
+                              Area( ctuXPosInCtus * maxCUSize, ctuYPosInCtus * maxCUSize, maxCUSize, maxCUSize ) );
+      worker.cuDecoder.decompressCtu( cs, ctuArea );
+
+      {
+        std::unique_lock<std::mutex> lock( m_reconMutex );
+        m_ctuReconDone[ctuRsAddr] = 1;
+        m_numCtusReconstructed++;
+      }
+      m_reconCond.notify_all();
+      if( m_ctuReconstructed )
+      {
+        m_ctuReconstructed( ctuRsAddr );
+      }
+    }
+  }
+  catch( ... )
+  {
+    {
+      std::unique_lock<std::mutex> lock( m_reconMutex );
+      m_reconAbort = true;
+    }
+    m_reconCond.notify_all();
+    throw;
+  }
+}
+
 //! \}
@@ -42,9 +42,14 @@
 
 #include "CommonLib/CommonDef.h"
 #include "CommonLib/BitStream.h"
+#include "CommonLib/ThreadPool.h"
 #include "DecCu.h"
 #include "CABACReader.h"
 
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
 //! \ingroup DecoderLib
 //! \{
 
@@ -52,6 +57,17 @@
 // Class definition
 // ====================================================================================================================
 
+/// reconstruction objects owned by one worker thread of the parallel CTU reconstruction
+struct CtuReconWorker
+{
+  IntraPrediction intraPred;
+  InterPrediction interPred;
+  TrQuant         trQuant;
+  RdCost          rdCost;
+  Reshape         reshaper;
+  DecCu           cuDecoder;
+};
+
 /// slice decoder class
 class DecSlice
 {
@@ -63,6 +79,27 @@ private:
   Ctx             m_entropyCodingSyncContextState;      ///< context storage for state of contexts at the wavefront/WPP/entropy-coding-sync second CTU of tile-row
   PLTBuf          m_palettePredictorSyncState;      /// palette predictor storage at wavefront/WPP
 
+  // parallel CTU reconstruction: CTUs are parsed in order on the calling thread, CTU lines are reconstructed by the pool
+  ThreadPool*                  m_threadPool;
+  std::vector<CtuReconWorker*> m_reconWorkers;          ///< one per pool thread
+  TrQuant*                     m_masterTrQuant;         ///< slice level scaling list state is copied from here
+  Reshape*                     m_masterReshaper;        ///< slice level LMCS state is copied from here
+  WaitCounter                  m_reconCounter;
+  std::mutex                   m_reconMutex;
+  std::condition_variable      m_reconCond;
+  std::vector<char>            m_ctuReconDone;          ///< per CTU in raster scan order
+  unsigned                     m_numCtusParsed;         ///< CTUs of the current slice whose syntax has been parsed
+  unsigned                     m_numCtusReconstructed;  ///< CTUs of the current slice that have been reconstructed
+  bool                         m_reconAbort;
+  unsigned                     m_maxCtusParsedAhead;    ///< bound of the parsed CTUs awaiting reconstruction
+  bool                         m_decoupledParsing;      ///< also reconstruct on the pool when the bitstream has no parallelism tools
+  std::function<void( unsigned )> m_ctuReconstructed;   ///< called with the raster scan address of each reconstructed CTU
+
+  bool  xUseParallelRecon ( const Slice* slice, int debugCTU ) const;
+  void  xReconstructCtuLine( const Slice* slice, unsigned startCtuIdx, unsigned numCtus, int threadIdx );
+  void  xCtuParsed        ();
+  void  xWaitCtuRecon     ( unsigned maxCtusPending = 0 );
+
 public:
   DecSlice();
   virtual ~DecSlice();
@@ -71,6 +108,16 @@ public:
   void  create            ();
   void  destroy           ();
 
+  /// enables parallel CTU reconstruction on the given pool (nullptr: single-threaded)
+  void  setThreadPool     ( ThreadPool* threadPool ) { m_threadPool = threadPool; }
+  /// (re-)initializes the per-thread reconstruction objects for the active parameter sets
+  void  initReconWorkers  ( const SPS* sps, TrQuant* trQuant, Reshape* reshaper );
+  void  destroyReconWorkers();
+  /// reconstructs the CTUs on the pool behind the parser also for slices without wavefronts, tiles or subpictures
+  void  setDecoupledParsing( bool enable ) { m_decoupledParsing = enable; }
+  /// sets the function called after each CTU reconstruction, possibly from a worker thread (empty: none)
+  void  setCtuReconstructedCallback( std::function<void( unsigned ctuRsAddr )> callback ) { m_ctuReconstructed = std::move( callback ); }
+
   void  decompressSlice   ( Slice* slice, InputBitstream* bitstream, int debugCTU );
 };
 
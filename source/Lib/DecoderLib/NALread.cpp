@@ -39,6 +39,7 @@
 
 #include <vector>
 #include <algorithm>
+#include <cstring>
 #include <ostream>
 
 #include "NALread.h"
@@ -56,33 +57,57 @@
 //! \{
 static void convertPayloadToRBSP(std::vector<uint8_t> &nalUnitBuf, InputBitstream *bitstream, bool isVclNalUnit)
 {
-  uint32_t zeroCount = 0;
-  std::vector<uint8_t>::iterator it_read, it_write;
-
-  uint32_t pos = 0;
   bitstream->clearEmulationPreventionByteLocation();
-  for (it_read = it_write = nalUnitBuf.begin(); it_read != nalUnitBuf.end(); it_read++, it_write++, pos++)
+  CHECK(!nalUnitBuf.empty() && nalUnitBuf.back() == 0x00, "Zero count not '0'");
+
+  // only the zero byte pairs need to be looked at, the bytes between them are moved in runs
+  uint8_t *const       begin    = nalUnitBuf.data();
+  const uint8_t *const end      = begin + nalUnitBuf.size();
+  const uint8_t       *it_read  = begin;
+  uint8_t             *it_write = begin;
+  const uint8_t       *scan     = begin;
+
+  while (end - scan >= 3)
   {
-    CHECK(zeroCount >= 2 && *it_read < 0x03, "Zero count is '2' and read value is small than '3'");
-    if (zeroCount == 2 && *it_read == 0x03)
+    const uint8_t *zero = static_cast<const uint8_t *>(memchr(scan, 0x00, end - scan - 2));
+    if (zero == nullptr)
+    {
+      break;
+    }
+    if (zero[1] != 0x00)
+    {
+      scan = zero + 2;
+      continue;
+    }
+    CHECK(zero[2] < 0x03, "Zero count is '2' and read value is small than '3'");
+    if (zero[2] > 0x03)
     {
-      bitstream->pushEmulationPreventionByteLocation( pos );
-      pos++;
-      it_read++;
-      zeroCount = 0;
+      scan = zero + 3;
+      continue;
+    }
+
+    // emulation_prevention_three_byte
+    const size_t numBytes = zero + 2 - it_read;
+    if (it_write != it_read)
+    {
+      memmove(it_write, it_read, numBytes);
+    }
+    it_write += numBytes;
+    bitstream->pushEmulationPreventionByteLocation(uint32_t(zero + 2 - begin));
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
-      CodingStatistics::IncrementStatisticEP(STATS__EMULATION_PREVENTION_3_BYTES, 8, 0);
+    CodingStatistics::IncrementStatisticEP(STATS__EMULATION_PREVENTION_3_BYTES, 8, 0);
 #endif
-      if (it_read == nalUnitBuf.end())
-      {
-        break;
-      }
-      CHECK(*it_read > 0x03, "Read a value bigger than '3'");
-    }
-    zeroCount = (*it_read == 0x00) ? zeroCount+1 : 0;
-    *it_write = *it_read;
+    it_read = zero + 3;
+    CHECK(it_read < end && *it_read > 0x03, "Read a value bigger than '3'");
+    scan = it_read;
+  }
+
+  const size_t numBytes = end - it_read;
+  if (it_write != it_read)
+  {
+    memmove(it_write, it_read, numBytes);
   }
-  CHECK(zeroCount != 0, "Zero count not '0'");
+  it_write += numBytes;
 
   if (isVclNalUnit)
   {
@@ -101,7 +126,7 @@ static void convertPayloadToRBSP(std::vector<uint8_t> &nalUnitBuf, InputBitstrea
     }
   }
 
-  nalUnitBuf.resize(it_write - nalUnitBuf.begin());
+  nalUnitBuf.resize(it_write - begin);
 }
 
 #if ENABLE_TRACING
@@ -2138,7 +2138,6 @@ void EncAdaptiveLoopFilter::getFrameStat(AlfCovariance *frameCov, AlfCovariance
 
 void EncAdaptiveLoopFilter::deriveStatsForFiltering( PelUnitBuf& orgYuv, PelUnitBuf& recYuv, CodingStructure& cs )
 {
-  int ctuRsAddr = 0;
   const int numberOfComponents = getNumberValidComponents( m_chromaFormat );
 
   // init CTU stats buffers
@@ -2177,145 +2176,169 @@ void EncAdaptiveLoopFilter::deriveStatsForFiltering( PelUnitBuf& orgYuv, PelUnit
     }
   }
 
+  // the CTU statistics are independent of each other, the frame statistics are summed up in CTU order afterwards
+  if (m_threadPool == nullptr)
+  {
+    for (int yPos = 0; yPos < m_picHeight; yPos += m_maxCUHeight)
+    {
+      deriveStatsForCtuRow(orgYuv, recYuv, cs, yPos, m_tempBuf2);
+    }
+  }
+  else
+  {
+    WaitCounter counter;
+    for (int yPos = 0; yPos < m_picHeight; yPos += m_maxCUHeight)
+    {
+      m_threadPool->addTask(
+        [&, yPos](int)
+        {
+          PelStorage tempBuf;
+          tempBuf.create(m_chromaFormat,
+                         Area(0, 0, m_maxCUWidth + (MAX_ALF_PADDING_SIZE << 1),
+                              m_maxCUHeight + (MAX_ALF_PADDING_SIZE << 1)),
+                         m_maxCUWidth, MAX_ALF_PADDING_SIZE, 0, false);
+          deriveStatsForCtuRow(orgYuv, recYuv, cs, yPos, tempBuf);
+        },
+        &counter);
+    }
+    counter.wait();
+  }
+
+  for (int ctuRsAddr = 0; ctuRsAddr < m_numCTUsInPic; ctuRsAddr++)
+  {
+    for (int compIdx = 0; compIdx < numberOfComponents; compIdx++)
+    {
+      const ComponentID compID = ComponentID(compIdx);
+      const ChannelType chType = toChannelType(compID);
+      const int numClasses = isLuma(compID) ? MAX_NUM_ALF_CLASSES : 1;
+
+      for (int shape = 0; shape != m_filterShapes[chType].size(); shape++)
+      {
+        for (int classIdx = 0; classIdx < numClasses; classIdx++)
+        {
+          m_alfCovarianceFrame[chType][shape][isLuma(compID) ? classIdx : 0] +=
+            m_alfCovariance[compIdx][shape][ctuRsAddr][classIdx];
+        }
+      }
+    }
+  }
+}
+
+void EncAdaptiveLoopFilter::deriveStatsForCtuRow(PelUnitBuf &orgYuv, PelUnitBuf &recYuv, CodingStructure &cs,
+                                                 const int yPos, PelStorage &tempBuf)
+{
+  const int numberOfComponents = getNumberValidComponents( m_chromaFormat );
   const PreCalcValues& pcv = *cs.pcv;
   bool clipTop = false, clipBottom = false, clipLeft = false, clipRight = false;
   int numHorVirBndry = 0, numVerVirBndry = 0;
   int horVirBndryPos[] = { 0, 0, 0 };
   int verVirBndryPos[] = { 0, 0, 0 };
 
-  for( int yPos = 0; yPos < m_picHeight; yPos += m_maxCUHeight )
+  int ctuRsAddr = ( yPos / m_maxCUHeight ) * m_numCTUsInWidth;
+  for( int xPos = 0; xPos < m_picWidth; xPos += m_maxCUWidth )
   {
-    for( int xPos = 0; xPos < m_picWidth; xPos += m_maxCUWidth )
+    const int width = ( xPos + m_maxCUWidth > m_picWidth ) ? ( m_picWidth - xPos ) : m_maxCUWidth;
+    const int height = ( yPos + m_maxCUHeight > m_picHeight ) ? ( m_picHeight - yPos ) : m_maxCUHeight;
+    int rasterSliceAlfPad = 0;
+    if( isCrossedByVirtualBoundaries( cs, xPos, yPos, width, height, clipTop, clipBottom, clipLeft, clipRight, numHorVirBndry, numVerVirBndry, horVirBndryPos, verVirBndryPos, rasterSliceAlfPad ) )
     {
-      const int width = ( xPos + m_maxCUWidth > m_picWidth ) ? ( m_picWidth - xPos ) : m_maxCUWidth;
-      const int height = ( yPos + m_maxCUHeight > m_picHeight ) ? ( m_picHeight - yPos ) : m_maxCUHeight;
-      int rasterSliceAlfPad = 0;
-      if( isCrossedByVirtualBoundaries( cs, xPos, yPos, width, height, clipTop, clipBottom, clipLeft, clipRight, numHorVirBndry, numVerVirBndry, horVirBndryPos, verVirBndryPos, rasterSliceAlfPad ) )
+      int yStart = yPos;
+      for( int i = 0; i <= numHorVirBndry; i++ )
       {
-        int yStart = yPos;
-        for( int i = 0; i <= numHorVirBndry; i++ )
+        const int yEnd = i == numHorVirBndry ? yPos + height : horVirBndryPos[i];
+        const int h = yEnd - yStart;
+        const bool clipT = ( i == 0 && clipTop ) || ( i > 0 ) || ( yStart == 0 );
+        const bool clipB = ( i == numHorVirBndry && clipBottom ) || ( i < numHorVirBndry ) || ( yEnd == pcv.lumaHeight );
+        int xStart = xPos;
+        for( int j = 0; j <= numVerVirBndry; j++ )
         {
-          const int yEnd = i == numHorVirBndry ? yPos + height : horVirBndryPos[i];
-          const int h = yEnd - yStart;
-          const bool clipT = ( i == 0 && clipTop ) || ( i > 0 ) || ( yStart == 0 );
-          const bool clipB = ( i == numHorVirBndry && clipBottom ) || ( i < numHorVirBndry ) || ( yEnd == pcv.lumaHeight );
-          int xStart = xPos;
-          for( int j = 0; j <= numVerVirBndry; j++ )
+          const int xEnd = j == numVerVirBndry ? xPos + width : verVirBndryPos[j];
+          const int w = xEnd - xStart;
+          const bool clipL = ( j == 0 && clipLeft ) || ( j > 0 ) || ( xStart == 0 );
+          const bool clipR = ( j == numVerVirBndry && clipRight ) || ( j < numVerVirBndry ) || ( xEnd == pcv.lumaWidth );
+          const int wBuf = w + (clipL ? 0 : MAX_ALF_PADDING_SIZE) + (clipR ? 0 : MAX_ALF_PADDING_SIZE);
+          const int hBuf = h + (clipT ? 0 : MAX_ALF_PADDING_SIZE) + (clipB ? 0 : MAX_ALF_PADDING_SIZE);
+          PelUnitBuf recBuf = tempBuf.subBuf( UnitArea( cs.area.chromaFormat, Area( 0, 0, wBuf, hBuf ) ) );
+          recBuf.copyFrom( recYuv.subBuf( UnitArea( cs.area.chromaFormat, Area( xStart - (clipL ? 0 : MAX_ALF_PADDING_SIZE), yStart - (clipT ? 0 : MAX_ALF_PADDING_SIZE), wBuf, hBuf ) ) ) );
+          // pad top-left unavailable samples for raster slice
+          if ( xStart == xPos && yStart == yPos && ( rasterSliceAlfPad & 1 ) )
           {
-            const int xEnd = j == numVerVirBndry ? xPos + width : verVirBndryPos[j];
-            const int w = xEnd - xStart;
-            const bool clipL = ( j == 0 && clipLeft ) || ( j > 0 ) || ( xStart == 0 );
-            const bool clipR = ( j == numVerVirBndry && clipRight ) || ( j < numVerVirBndry ) || ( xEnd == pcv.lumaWidth );
-            const int wBuf = w + (clipL ? 0 : MAX_ALF_PADDING_SIZE) + (clipR ? 0 : MAX_ALF_PADDING_SIZE);
-            const int hBuf = h + (clipT ? 0 : MAX_ALF_PADDING_SIZE) + (clipB ? 0 : MAX_ALF_PADDING_SIZE);
-            PelUnitBuf recBuf = m_tempBuf2.subBuf( UnitArea( cs.area.chromaFormat, Area( 0, 0, wBuf, hBuf ) ) );
-            recBuf.copyFrom( recYuv.subBuf( UnitArea( cs.area.chromaFormat, Area( xStart - (clipL ? 0 : MAX_ALF_PADDING_SIZE), yStart - (clipT ? 0 : MAX_ALF_PADDING_SIZE), wBuf, hBuf ) ) ) );
-            // pad top-left unavailable samples for raster slice
-            if ( xStart == xPos && yStart == yPos && ( rasterSliceAlfPad & 1 ) )
-            {
-              recBuf.padBorderPel( MAX_ALF_PADDING_SIZE, 1 );
-            }
+            recBuf.padBorderPel( MAX_ALF_PADDING_SIZE, 1 );
+          }
 
-            // pad bottom-right unavailable samples for raster slice
-            if ( xEnd == xPos + width && yEnd == yPos + height && ( rasterSliceAlfPad & 2 ) )
-            {
-              recBuf.padBorderPel( MAX_ALF_PADDING_SIZE, 2 );
-            }
-            recBuf.extendBorderPel( MAX_ALF_PADDING_SIZE );
-            recBuf = recBuf.subBuf( UnitArea ( cs.area.chromaFormat, Area( clipL ? 0 : MAX_ALF_PADDING_SIZE, clipT ? 0 : MAX_ALF_PADDING_SIZE, w, h ) ) );
+          // pad bottom-right unavailable samples for raster slice
+          if ( xEnd == xPos + width && yEnd == yPos + height && ( rasterSliceAlfPad & 2 ) )
+          {
+            recBuf.padBorderPel( MAX_ALF_PADDING_SIZE, 2 );
+          }
+          recBuf.extendBorderPel( MAX_ALF_PADDING_SIZE );
+          recBuf = recBuf.subBuf( UnitArea ( cs.area.chromaFormat, Area( clipL ? 0 : MAX_ALF_PADDING_SIZE, clipT ? 0 : MAX_ALF_PADDING_SIZE, w, h ) ) );
 
-            const UnitArea area( m_chromaFormat, Area( 0, 0, w, h ) );
-            const UnitArea areaDst( m_chromaFormat, Area( xStart, yStart, w, h ) );
-            for( int compIdx = 0; compIdx < numberOfComponents; compIdx++ )
-            {
-              const ComponentID compID = ComponentID( compIdx );
-              const CompArea& compArea = area.block( compID );
+          const UnitArea area( m_chromaFormat, Area( 0, 0, w, h ) );
+          const UnitArea areaDst( m_chromaFormat, Area( xStart, yStart, w, h ) );
+          for( int compIdx = 0; compIdx < numberOfComponents; compIdx++ )
+          {
+            const ComponentID compID = ComponentID( compIdx );
+            const CompArea& compArea = area.block( compID );
 
-              ptrdiff_t recStride = recBuf.get(compID).stride;
-              Pel* rec = recBuf.get( compID ).bufAt( compArea );
+            ptrdiff_t recStride = recBuf.get(compID).stride;
+            Pel* rec = recBuf.get( compID ).bufAt( compArea );
 
-              ptrdiff_t orgStride = orgYuv.get(compID).stride;
-              Pel* org = orgYuv.get(compID).bufAt(xStart >> ::getComponentScaleX(compID, m_chromaFormat), yStart >> ::getComponentScaleY(compID, m_chromaFormat));
+            ptrdiff_t orgStride = orgYuv.get(compID).stride;
+            Pel* org = orgYuv.get(compID).bufAt(xStart >> ::getComponentScaleX(compID, m_chromaFormat), yStart >> ::getComponentScaleY(compID, m_chromaFormat));
 
-              ptrdiff_t orgLumaStride = orgYuv.get(COMPONENT_Y).stride;
-              Pel      *orgLuma       = orgYuv.get(COMPONENT_Y).bufAt(xStart, yStart);
+            ptrdiff_t orgLumaStride = orgYuv.get(COMPONENT_Y).stride;
+            Pel      *orgLuma       = orgYuv.get(COMPONENT_Y).bufAt(xStart, yStart);
 
-              ChannelType chType = toChannelType( compID );
+            ChannelType chType = toChannelType( compID );
 
-              for (int shape = 0; shape != m_filterShapes[chType].size(); shape++)
-              {
-                const CompArea &compAreaDst = areaDst.block(compID);
-                getBlkStats(m_alfCovariance[compIdx][shape][ctuRsAddr], m_filterShapes[chType][shape],
-                            compIdx ? nullptr : m_classifier, org, orgStride, orgLuma, orgLumaStride, rec, recStride,
-                            compAreaDst, compArea, chType,
-                            ((compIdx == 0) ? m_alfVBLumaCTUHeight : m_alfVBChmaCTUHeight),
-                            (compIdx == 0) ? m_alfVBLumaPos : m_alfVBChmaPos);
-              }
+            for (int shape = 0; shape != m_filterShapes[chType].size(); shape++)
+            {
+              const CompArea &compAreaDst = areaDst.block(compID);
+              getBlkStats(m_alfCovariance[compIdx][shape][ctuRsAddr], m_filterShapes[chType][shape],
+                          compIdx ? nullptr : m_classifier, org, orgStride, orgLuma, orgLumaStride, rec, recStride,
+                          compAreaDst, compArea, chType,
+                          ((compIdx == 0) ? m_alfVBLumaCTUHeight : m_alfVBChmaCTUHeight),
+                          (compIdx == 0) ? m_alfVBLumaPos : m_alfVBChmaPos);
             }
-
-            xStart = xEnd;
           }
 
-          yStart = yEnd;
+          xStart = xEnd;
         }
 
-        for( int compIdx = 0; compIdx < numberOfComponents; compIdx++ )
-        {
-          const ComponentID compID = ComponentID( compIdx );
-
-          ChannelType chType = toChannelType( compID );
-
-          for (int shape = 0; shape != m_filterShapes[chType].size(); shape++)
-          {
-            const int numClasses = isLuma( compID ) ? MAX_NUM_ALF_CLASSES : 1;
-
-            for( int classIdx = 0; classIdx < numClasses; classIdx++ )
-            {
-              m_alfCovarianceFrame[chType][shape][isLuma(compID) ? classIdx : 0] +=
-                m_alfCovariance[compIdx][shape][ctuRsAddr][classIdx];
-            }
-          }
-        }
+        yStart = yEnd;
       }
-      else
-      {
-        const UnitArea area(m_chromaFormat, Area(xPos, yPos, width, height));
-
-        for (int compIdx = 0; compIdx < numberOfComponents; compIdx++)
-        {
-          const ComponentID compID   = ComponentID(compIdx);
-          const CompArea &  compArea = area.block(compID);
-
-          ptrdiff_t recStride = recYuv.get(compID).stride;
-          Pel *rec       = recYuv.get(compID).bufAt(compArea);
+    }
+    else
+    {
+      const UnitArea area(m_chromaFormat, Area(xPos, yPos, width, height));
 
-          ptrdiff_t orgStride = orgYuv.get(compID).stride;
-          Pel *org       = orgYuv.get(compID).bufAt(compArea);
+      for (int compIdx = 0; compIdx < numberOfComponents; compIdx++)
+      {
+        const ComponentID compID   = ComponentID(compIdx);
+        const CompArea &  compArea = area.block(compID);
 
-          ptrdiff_t orgLumaStride = orgYuv.get(COMPONENT_Y).stride;
-          Pel      *orgLuma       = orgYuv.get(COMPONENT_Y).bufAt(area.block(COMPONENT_Y));
+        ptrdiff_t recStride = recYuv.get(compID).stride;
+        Pel *rec       = recYuv.get(compID).bufAt(compArea);
 
-          ChannelType chType = toChannelType(compID);
+        ptrdiff_t orgStride = orgYuv.get(compID).stride;
+        Pel *org       = orgYuv.get(compID).bufAt(compArea);
 
-          for (int shape = 0; shape != m_filterShapes[chType].size(); shape++)
-          {
-            getBlkStats(m_alfCovariance[compIdx][shape][ctuRsAddr], m_filterShapes[chType][shape],
-                        compIdx ? nullptr : m_classifier, org, orgStride, orgLuma, orgLumaStride, rec, recStride,
-                        compArea, compArea, chType, ((compIdx == 0) ? m_alfVBLumaCTUHeight : m_alfVBChmaCTUHeight),
-                        (compIdx == 0) ? m_alfVBLumaPos : m_alfVBChmaPos);
+        ptrdiff_t orgLumaStride = orgYuv.get(COMPONENT_Y).stride;
+        Pel      *orgLuma       = orgYuv.get(COMPONENT_Y).bufAt(area.block(COMPONENT_Y));
 
-            const int numClasses = isLuma(compID) ? MAX_NUM_ALF_CLASSES : 1;
+        ChannelType chType = toChannelType(compID);
 
-            for (int classIdx = 0; classIdx < numClasses; classIdx++)
-            {
-              m_alfCovarianceFrame[chType][shape][isLuma(compID) ? classIdx : 0] +=
-                m_alfCovariance[compIdx][shape][ctuRsAddr][classIdx];
-            }
-          }
+        for (int shape = 0; shape != m_filterShapes[chType].size(); shape++)
+        {
+          getBlkStats(m_alfCovariance[compIdx][shape][ctuRsAddr], m_filterShapes[chType][shape],
+                      compIdx ? nullptr : m_classifier, org, orgStride, orgLuma, orgLumaStride, rec, recStride,
+                      compArea, compArea, chType, ((compIdx == 0) ? m_alfVBLumaCTUHeight : m_alfVBChmaCTUHeight),
+                      (compIdx == 0) ? m_alfVBLumaPos : m_alfVBChmaPos);
         }
       }
-      ctuRsAddr++;
     }
+    ctuRsAddr++;
   }
 }
 
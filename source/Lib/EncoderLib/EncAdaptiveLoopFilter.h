@@ -40,6 +40,7 @@
 
 #include "CommonLib/AdaptiveLoopFilter.h"
 #include "CommonLib/ParameterSetManager.h"
+#include "CommonLib/ThreadPool.h"
 
 #include "CABACWriter.h"
 #include "EncCfg.h"
@@ -278,10 +279,12 @@ class EncAdaptiveLoopFilter : public AdaptiveLoopFilter
 public:
   void setAlfWSSD(bool alfWSSD) { m_alfWSSD = alfWSSD; }
   void setLumaLevelWeightTable(const std::vector<double> &weightTable) { m_lumaLevelToWeightPLUT = weightTable; }
+  void setThreadPool(ThreadPool *threadPool) { m_threadPool = threadPool; }
 
 private:
   bool                m_alfWSSD{ false };
   std::vector<double> m_lumaLevelToWeightPLUT;
+  ThreadPool         *m_threadPool{ nullptr };   ///< worker threads gathering the CTU statistics (nullptr: none)
 
   const EncCfg*          m_encCfg;
   AlfCovariance***       m_alfCovariance[MAX_NUM_COMPONENT];          // [compIdx][shapeIdx][ctbAddr][classIdx]
@@ -377,6 +380,8 @@ private:
   void   getFrameStat(AlfCovariance *frameCov, AlfCovariance **ctbCov, AlfMode *ctbEnableFlags, const int numClasses,
                       int altIdx);
   void   deriveStatsForFiltering( PelUnitBuf& orgYuv, PelUnitBuf& recYuv, CodingStructure& cs );
+  void   deriveStatsForCtuRow(PelUnitBuf &orgYuv, PelUnitBuf &recYuv, CodingStructure &cs, const int yPos,
+                              PelStorage &tempBuf);
   void   getBlkStats(AlfCovariance *alfCovariace, const AlfFilterShape &shape, AlfClassifier **classifier, Pel *org,
                      const ptrdiff_t orgStride, const Pel *orgLuma, const ptrdiff_t orgLumaStride, Pel *rec,
                      const ptrdiff_t recStride, const CompArea &areaDst, const CompArea &area, const ChannelType channel,
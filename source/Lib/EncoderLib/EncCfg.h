@@ -570,6 +570,7 @@ protected:
   bool      m_singleSlicePerSubPicFlag;
   bool      m_entropyCodingSyncEnabledFlag;
   bool      m_entryPointPresentFlag;                           ///< flag for the presence of entry points
+  int       m_numThreads;                                      ///< number of threads encoding wavefront CTU lines and tiles and running the temporal filter, ALF/SAO statistics and quality metrics concurrently
 
   HashType  m_decodedPictureHashSEIType;
   HashType  m_subpicDecodedPictureHashType;
@@ -1771,6 +1772,7 @@ public:
   bool      getUseMttSkip                   () const         { return m_useMttSkip; }
  
   void      setLog2MaxTbSize                ( uint32_t  u )   { m_log2MaxTbSize = u; }
+  uint32_t  getLog2MaxTbSize                () const          { return m_log2MaxTbSize; }
 
   //====== Loop/Deblock Filter ========
   void      setDeblockingFilterDisable      ( bool  b )      { m_deblockingFilterDisable           = b; }
@@ -1790,6 +1792,7 @@ public:
     m_searchRange = i;
   }
   void      setBipredSearchRange            ( int   i )      { m_bipredSearchRange = i; }
+  int       getBipredSearchRange            () const         { return m_bipredSearchRange; }
   void      setClipForBiPredMeEnabled       ( bool  b )      { m_bClipForBiPredMeEnabled = b; }
   void      setFastMEAssumingSmootherMVEnabled ( bool b )    { m_bFastMEAssumingSmootherMVEnabled = b; }
   void      setMinSearchWindow              ( int   i )      { m_minSearchWindow = i; }
@@ -2069,6 +2072,8 @@ public:
   bool  getSaoGreedyMergeEnc           ()                            { return m_saoGreedyMergeEnc; }
   void  setEntropyCodingSyncEnabledFlag(bool b)                      { m_entropyCodingSyncEnabledFlag = b; }
   bool  getEntropyCodingSyncEnabledFlag() const                      { return m_entropyCodingSyncEnabledFlag; }
+  void  setNumThreads(int n)                                         { m_numThreads = n; }
+  int   getNumThreads() const                                        { return m_numThreads; }
   void  setEntryPointPresentFlag(bool b)                             { m_entryPointPresentFlag = b; }
   void  setDecodedPictureHashSEIType(HashType m)                     { m_decodedPictureHashSEIType = m; }
   HashType getDecodedPictureHashSEIType() const                      { return m_decodedPictureHashSEIType; }
@@ -205,15 +205,33 @@ EncCu::~EncCu()
 /** \param    pcEncLib      pointer of encoder class
  */
 void EncCu::init( EncLib* pcEncLib, const SPS& sps )
+{
+  init( pcEncLib, sps, pcEncLib->getIntraSearch(), pcEncLib->getInterSearch(), pcEncLib->getTrQuant(),
+        pcEncLib->getRdCost(), pcEncLib->getCABACEncoder(), pcEncLib->getCtxCache() );
+
+  m_pcGOPEncoder = pcEncLib->getGOPEncoder();
+  m_pcGOPEncoder->setModeCtrl( m_modeCtrl );
+}
+
+/** \param    pcEncLib      pointer of encoder class
+    \param    intraSearch   intra search used by this CU encoder
+    \param    interSearch   inter search used by this CU encoder
+    \param    trQuant       transform and quantization used by this CU encoder
+    \param    rdCost        RD cost computation used by this CU encoder
+    \param    cabacEncoder  CABAC coder providing the bit estimator
+    \param    ctxPool       context storage used by this CU encoder
+ */
+void EncCu::init( EncLib* pcEncLib, const SPS& sps, IntraSearch* intraSearch, InterSearch* interSearch,
+                  TrQuant* trQuant, RdCost* rdCost, CABACEncoder* cabacEncoder, CtxPool* ctxPool )
 {
   m_pcEncCfg           = pcEncLib;
-  m_pcIntraSearch      = pcEncLib->getIntraSearch();
-  m_pcInterSearch      = pcEncLib->getInterSearch();
-  m_pcTrQuant          = pcEncLib->getTrQuant();
-  m_pcRdCost           = pcEncLib->getRdCost ();
-  m_CABACEstimator     = pcEncLib->getCABACEncoder()->getCABACEstimator( &sps );
+  m_pcIntraSearch      = intraSearch;
+  m_pcInterSearch      = interSearch;
+  m_pcTrQuant          = trQuant;
+  m_pcRdCost           = rdCost;
+  m_CABACEstimator     = cabacEncoder->getCABACEstimator( &sps );
   m_CABACEstimator->setEncCu(this);
-  m_ctxPool            = pcEncLib->getCtxCache();
+  m_ctxPool            = ctxPool;
   m_pcRateCtrl         = pcEncLib->getRateCtrl();
   m_pcSliceEncoder     = pcEncLib->getSliceEncoder();
   m_deblockingFilter   = pcEncLib->getDeblockingFilter();
@@ -228,9 +246,6 @@ void EncCu::init( EncLib* pcEncLib, const SPS& sps )
   m_pcInterSearch->setModeCtrl( m_modeCtrl );
   m_modeCtrl->setInterSearch(m_pcInterSearch);
   m_pcIntraSearch->setModeCtrl( m_modeCtrl );
-
-  m_pcGOPEncoder = pcEncLib->getGOPEncoder();
-  m_pcGOPEncoder->setModeCtrl( m_modeCtrl );
 }
 
 // ====================================================================================================================
@@ -241,10 +256,13 @@ void EncCu::compressCtu(CodingStructure &cs, const UnitArea &area, const unsigne
                         const EnumArray<int, ChannelType> &prevQP, const EnumArray<int, ChannelType> &currQP)
 {
   m_modeCtrl->initCTUEncoding( *cs.slice );
-  cs.treeType = TREE_D;
 
+  // the picture level structures may be shared with CU encoders working on other CTU lines
+  std::unique_lock<std::shared_mutex> unitStorageLock( cs.picture->unitStorageMutex );
+  cs.treeType = TREE_D;
   cs.slice->m_mapPltCost[0].clear();
   cs.slice->m_mapPltCost[1].clear();
+  unitStorageLock.unlock();
   // init the partitioning manager
   QTBTPartitioner partitioner;
   partitioner.initCtu(area, ChannelType::LUMA, *cs.slice);
@@ -278,19 +296,23 @@ void EncCu::compressCtu(CodingStructure &cs, const UnitArea &area, const unsigne
   CodingStructure *tempCS = m_pTempCS[gp_sizeIdxInfo->idxFrom( area.lumaSize().width )][gp_sizeIdxInfo->idxFrom( area.lumaSize().height )];
   CodingStructure *bestCS = m_pBestCS[gp_sizeIdxInfo->idxFrom( area.lumaSize().width )][gp_sizeIdxInfo->idxFrom( area.lumaSize().height )];
 
+  unitStorageLock.lock();
   cs.initSubStructure(*tempCS, partitioner.chType, partitioner.currArea(), false);
   cs.initSubStructure(*bestCS, partitioner.chType, partitioner.currArea(), false);
+  unitStorageLock.unlock();
   tempCS->currQP[ChannelType::LUMA] = bestCS->currQP[ChannelType::LUMA] = tempCS->baseQP = bestCS->baseQP =
     currQP[ChannelType::LUMA];
   tempCS->prevQP[ChannelType::LUMA] = bestCS->prevQP[ChannelType::LUMA] = prevQP[ChannelType::LUMA];
 
   xCompressCU(tempCS, bestCS, partitioner);
+  unitStorageLock.lock();
   cs.slice->m_mapPltCost[0].clear();
   cs.slice->m_mapPltCost[1].clear();
   // all signals were already copied during compression if the CTU was split - at this point only the structures are copied to the top level CS
   const bool copyUnsplitCTUSignals = bestCS->cus.size() == 1;
   cs.useSubStructure(*bestCS, partitioner.chType, CS::getArea(*bestCS, area, partitioner.chType), copyUnsplitCTUSignals,
                      false, false, copyUnsplitCTUSignals, true);
+  unitStorageLock.unlock();
 
   if (CS::isDualITree (cs) && isChromaEnabled (cs.pcv->chrFormat))
   {
@@ -298,8 +320,10 @@ void EncCu::compressCtu(CodingStructure &cs, const UnitArea &area, const unsigne
 
     partitioner.initCtu(area, ChannelType::CHROMA, *cs.slice);
 
+    unitStorageLock.lock();
     cs.initSubStructure(*tempCS, partitioner.chType, partitioner.currArea(), false);
     cs.initSubStructure(*bestCS, partitioner.chType, partitioner.currArea(), false);
+    unitStorageLock.unlock();
     tempCS->currQP[ChannelType::CHROMA] = bestCS->currQP[ChannelType::CHROMA] = tempCS->baseQP = bestCS->baseQP =
       currQP[ChannelType::CHROMA];
     tempCS->prevQP[ChannelType::CHROMA] = bestCS->prevQP[ChannelType::CHROMA] = prevQP[ChannelType::CHROMA];
@@ -307,8 +331,10 @@ void EncCu::compressCtu(CodingStructure &cs, const UnitArea &area, const unsigne
     xCompressCU(tempCS, bestCS, partitioner);
 
     const bool copyUnsplitCTUSignals = bestCS->cus.size() == 1;
+    unitStorageLock.lock();
     cs.useSubStructure(*bestCS, partitioner.chType, CS::getArea(*bestCS, area, partitioner.chType),
                        copyUnsplitCTUSignals, false, false, copyUnsplitCTUSignals, true);
+    unitStorageLock.unlock();
   }
 
   if (m_pcEncCfg->getUseRateCtrl())
@@ -1375,6 +1401,9 @@ void EncCu::xCheckModeSplit(CodingStructure *&tempCS, CodingStructure *&bestCS,
       }
     }
     assert( tempCS->treeType == TREE_L );
+    // the luma units are made visible to the chroma search through the picture level structure and are removed
+    // afterwards, which must not interleave with the units added by CU encoders working on other CTU lines
+    std::unique_lock<std::shared_mutex> unitStorageLock( tempCS->picture->unitStorageMutex );
     uint32_t numCuPuTu[6];
     tempCS->picture->cs->getNumCuPuTuOffset( numCuPuTu );
     tempCS->picture->cs->useSubStructure( *tempCS, partitioner.chType, CS::getArea( *tempCS, partitioner.currArea(), partitioner.chType ), false, true, false, false, false );
@@ -1410,6 +1439,7 @@ void EncCu::xCheckModeSplit(CodingStructure *&tempCS, CodingStructure *&bestCS,
       m_CurrCtx--;
     }
     tempCS->picture->cs->clearCuPuTuIdxMap( partitioner.currArea(), numCuPuTu[0], numCuPuTu[1], numCuPuTu[2], numCuPuTu + 3 );
+    unitStorageLock.unlock();
 
 
     //recover luma tree status
@@ -299,6 +299,9 @@ private:
 public:
   /// copy parameters from encoder class
   void  init                ( EncLib* pcEncLib, const SPS& sps );
+  /// copy parameters from encoder class, using the given search and coding objects instead of the encoder's own
+  void  init                ( EncLib* pcEncLib, const SPS& sps, IntraSearch* intraSearch, InterSearch* interSearch,
+                              TrQuant* trQuant, RdCost* rdCost, CABACEncoder* cabacEncoder, CtxPool* ctxPool );
 
   void setDecCuReshaperInEncCU(EncReshape* pcReshape, ChromaFormat chromaFormatIdc)
   {
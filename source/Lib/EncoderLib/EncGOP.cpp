@@ -2629,7 +2629,9 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
 
     const bool isCurrentFrameFiltered = m_pcCfg->getGopBasedTemporalFilterEnabled() || m_pcCfg->getBIM();
     const bool isFgFiltered = m_pcCfg->getFilmGrainAnalysisEnabled() && m_pcCfg->getFilmGrainExternalDenoised().empty();
-    pcPic->createTempBuffers(pcPic->cs->pps->pcv->maxCUWidth, isCurrentFrameFiltered, m_pcEncLib->isResChangeInClvsEnabled(), false, isFgFiltered);
+    // CTU lines encoded concurrently need disjoint prediction and residual buffers
+    pcPic->createTempBuffers(pcPic->cs->pps->pcv->maxCUWidth, isCurrentFrameFiltered, m_pcEncLib->isResChangeInClvsEnabled(), false, isFgFiltered,
+                             m_pcEncLib->getNumThreads() <= 1);
     pcPic->getTrueOrigBuf().copyFrom(pcPic->getOrigBuf());
     if (m_pcEncLib->isResChangeInClvsEnabled())
     {
@@ -2660,7 +2662,7 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
         Picture::rescalePicture(scalingRatio, pcPic->M_BUFS(0, PIC_ORIGINAL_INPUT), curScalingWindow, pcPic->M_BUFS(0, PIC_ORIGINAL), pps->getScalingWindow(), chromaFormatIdc, sps.getBitDepths(), true, true,
           sps.getHorCollocatedChromaFlag(), sps.getVerCollocatedChromaFlag());
       }
-      else
+      else if (!m_pcEncLib->getTemporalFilter().takeFilteredAhead(&pcPic->M_BUFS(0, PIC_ORIGINAL), pocCurr))
       {
         m_pcEncLib->getTemporalFilter().filter(&pcPic->M_BUFS(0, PIC_ORIGINAL), pocCurr);
       }
@@ -5436,98 +5438,117 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
     }
   }
 
+  // the components are measured independently of each other, each MS-SSIM in a task of its own
+  ThreadPool *threadPool = m_pcEncLib->getThreadPool();
+  WaitCounter metricsCounter;
+  auto measure = [&](std::function<void()> metric)
+  {
+    if (threadPool)
+    {
+      threadPool->addTask([metric](int) { metric(); }, &metricsCounter);
+    }
+    else
+    {
+      metric();
+    }
+  };
   for (int comp = 0; comp < ::getNumberValidComponents(formatD); comp++)
   {
-    const ComponentID compID = ComponentID(comp);
-    const CPelBuf&    p = picC.get(compID);
-    const CPelBuf&    o = org.get(compID);
+    measure([&, comp]()
+    {
+      const ComponentID compID = ComponentID(comp);
+      const CPelBuf&    p = picC.get(compID);
+      const CPelBuf&    o = org.get(compID);
 
-    CHECK(!( p.width  == o.width), "Unspecified error");
-    CHECK(!( p.height == o.height), "Unspecified error");
+      CHECK(!( p.width  == o.width), "Unspecified error");
+      CHECK(!( p.height == o.height), "Unspecified error");
 
-    int padX = m_pcEncLib->getSourcePadding( 0 );
-    int padY = m_pcEncLib->getSourcePadding( 1 );
+      int padX = m_pcEncLib->getSourcePadding( 0 );
+      int padY = m_pcEncLib->getSourcePadding( 1 );
 
-    // when RPR is enabled, picture padding is picture specific due to possible different picture resoluitons, however only full resolution padding is stored in EncLib
-    // get per picture padding from the conformance window, in this case if conformance window is set not equal to the padding then PSNR results may be inaccurate
-    if (m_pcEncLib->isResChangeInClvsEnabled())
-    {
-      const Window& conf = pcPic->getConformanceWindow();
-      padX = conf.getWindowRightOffset() * SPS::getWinUnitX( format );
-      padY = conf.getWindowBottomOffset() * SPS::getWinUnitY( format );
-    }
+      // when RPR is enabled, picture padding is picture specific due to possible different picture resoluitons, however only full resolution padding is stored in EncLib
+      // get per picture padding from the conformance window, in this case if conformance window is set not equal to the padding then PSNR results may be inaccurate
+      if (m_pcEncLib->isResChangeInClvsEnabled())
+      {
+        const Window& conf = pcPic->getConformanceWindow();
+        padX = conf.getWindowRightOffset() * SPS::getWinUnitX( format );
+        padY = conf.getWindowBottomOffset() * SPS::getWinUnitY( format );
+      }
 
-    const uint32_t width = p.width - ( padX >> ::getComponentScaleX( compID, format ) );
-    const uint32_t height = p.height - ( padY >> ( !!bPicIsField + ::getComponentScaleY( compID, format ) ) );
+      const uint32_t width = p.width - ( padX >> ::getComponentScaleX( compID, format ) );
+      const uint32_t height = p.height - ( padY >> ( !!bPicIsField + ::getComponentScaleY( compID, format ) ) );
 
-    // create new buffers with correct dimensions
-    const CPelBuf recPB(p.bufAt(0, 0), p.stride, width, height);
-    const CPelBuf orgPB(o.bufAt(0, 0), o.stride, width, height);
-    const uint32_t    bitDepth = sps.getBitDepth(toChannelType(compID));
+      // create new buffers with correct dimensions
+      const CPelBuf recPB(p.bufAt(0, 0), p.stride, width, height);
+      const CPelBuf orgPB(o.bufAt(0, 0), o.stride, width, height);
+      const uint32_t    bitDepth = sps.getBitDepth(toChannelType(compID));
 #if ENABLE_QPA
-    const uint64_t ssdTemp =
-      xFindDistortionPlane(recPB, orgPB, useWPSNR ? bitDepth : 0, ::getComponentScaleX(compID, format),
-                           ::getComponentScaleY(compID, format));
+      const uint64_t ssdTemp =
+        xFindDistortionPlane(recPB, orgPB, useWPSNR ? bitDepth : 0, ::getComponentScaleX(compID, format),
+                             ::getComponentScaleY(compID, format));
 #else
-    const uint64_t ssdTemp = xFindDistortionPlane(recPB, orgPB, 0);
+      const uint64_t ssdTemp = xFindDistortionPlane(recPB, orgPB, 0);
 #endif
-    const uint32_t maxval = 255 << (bitDepth - 8);
-    const uint32_t size   = width * height;
-    const double fRefValue = (double)maxval * maxval * size;
-    dPSNR[comp]              = ssdTemp ? 10.0 * log10(fRefValue / (double) ssdTemp) : 999.99;
-    mseYuvFrame[comp]        = (double) ssdTemp / size;
-    if(printMSSSIM)
-    {
-      msssim[comp] = xCalculateMSSSIM (o.bufAt(0, 0), o.stride, p.bufAt(0, 0), p.stride, width, height, bitDepth);
-    }
+      const uint32_t maxval = 255 << (bitDepth - 8);
+      const uint32_t size   = width * height;
+      const double fRefValue = (double)maxval * maxval * size;
+      dPSNR[comp]              = ssdTemp ? 10.0 * log10(fRefValue / (double) ssdTemp) : 999.99;
+      mseYuvFrame[comp]        = (double) ssdTemp / size;
+      if(printMSSSIM)
+      {
+        measure([=, &msssim]()
+                { msssim[comp] = xCalculateMSSSIM(o.bufAt(0, 0), o.stride, p.bufAt(0, 0), p.stride, width, height, bitDepth); });
+      }
 #if WCG_WPSNR
-    const double uiSSDtempWeighted = xFindDistortionPlaneWPSNR(recPB, orgPB, 0, org.get(COMPONENT_Y), compID, format);
-    if (useLumaWPSNR)
-    {
-      dPSNRWeighted[comp] = uiSSDtempWeighted ? 10.0 * log10(fRefValue / (double)uiSSDtempWeighted) : 999.99;
-      MSEyuvframeWeighted[comp] = (double)uiSSDtempWeighted / size;
-    }
+      const double uiSSDtempWeighted = xFindDistortionPlaneWPSNR(recPB, orgPB, 0, org.get(COMPONENT_Y), compID, format);
+      if (useLumaWPSNR)
+      {
+        dPSNRWeighted[comp] = uiSSDtempWeighted ? 10.0 * log10(fRefValue / (double)uiSSDtempWeighted) : 999.99;
+        MSEyuvframeWeighted[comp] = (double)uiSSDtempWeighted / size;
+      }
 #endif
 
 
-    if (m_pcEncLib->isResChangeInClvsEnabled())
-    {
-      const CPelBuf& upscaledOrg = (sps.getUseLmcs() || m_pcCfg->getGopBasedTemporalFilterEnabled()) ? pcPic->M_BUFS( 0, PIC_TRUE_ORIGINAL_INPUT).get( compID ) : pcPic->M_BUFS( 0, PIC_ORIGINAL_INPUT).get( compID );
+      if (m_pcEncLib->isResChangeInClvsEnabled())
+      {
+        const CPelBuf& upscaledOrg = (sps.getUseLmcs() || m_pcCfg->getGopBasedTemporalFilterEnabled()) ? pcPic->M_BUFS( 0, PIC_TRUE_ORIGINAL_INPUT).get( compID ) : pcPic->M_BUFS( 0, PIC_ORIGINAL_INPUT).get( compID );
 
-      const uint32_t upscaledWidth = upscaledOrg.width - ( m_pcEncLib->getSourcePadding( 0 ) >> ::getComponentScaleX( compID, format ) );
-      const uint32_t upscaledHeight = upscaledOrg.height - ( m_pcEncLib->getSourcePadding( 1 ) >> ( !!bPicIsField + ::getComponentScaleY( compID, format ) ) );
+        const uint32_t upscaledWidth = upscaledOrg.width - ( m_pcEncLib->getSourcePadding( 0 ) >> ::getComponentScaleX( compID, format ) );
+        const uint32_t upscaledHeight = upscaledOrg.height - ( m_pcEncLib->getSourcePadding( 1 ) >> ( !!bPicIsField + ::getComponentScaleY( compID, format ) ) );
 
-      // create new buffers with correct dimensions
-      const CPelBuf upscaledRecPB( upscaledRec.get( compID ).bufAt( 0, 0 ), upscaledRec.get( compID ).stride, upscaledWidth, upscaledHeight );
-      const CPelBuf upscaledOrgPB( upscaledOrg.bufAt( 0, 0 ), upscaledOrg.stride, upscaledWidth, upscaledHeight );
+        // create new buffers with correct dimensions
+        const CPelBuf upscaledRecPB( upscaledRec.get( compID ).bufAt( 0, 0 ), upscaledRec.get( compID ).stride, upscaledWidth, upscaledHeight );
+        const CPelBuf upscaledOrgPB( upscaledOrg.bufAt( 0, 0 ), upscaledOrg.stride, upscaledWidth, upscaledHeight );
 
 #if ENABLE_QPA
-      const uint64_t upscaledSSD = xFindDistortionPlane( upscaledRecPB, upscaledOrgPB, useWPSNR ? bitDepth : 0, ::getComponentScaleX( compID, format ) );
+        const uint64_t upscaledSSD = xFindDistortionPlane( upscaledRecPB, upscaledOrgPB, useWPSNR ? bitDepth : 0, ::getComponentScaleX( compID, format ) );
 #else
-      const uint64_t scaledSSD = xFindDistortionPlane( upsacledRecPB, upsacledOrgPB, 0 );
+        const uint64_t scaledSSD = xFindDistortionPlane( upsacledRecPB, upsacledOrgPB, 0 );
 #endif
 
-      upscaledPSNR[comp] = upscaledSSD ? 10.0 * log10( (double)maxval * maxval * upscaledWidth * upscaledHeight / (double)upscaledSSD ) : 999.99;
-      upscaledMsssim[comp] = xCalculateMSSSIM (upscaledOrgPB.bufAt(0, 0), upscaledOrgPB.stride, upscaledRecPB.bufAt(0, 0), upscaledRecPB.stride, upscaledWidth, upscaledHeight, bitDepth);
-    }
-    else if (picRefLayer)
-    {
-      const CPelBuf& p = m_pcRefLayerRescaledPicYuv->get(compID);
-      const CPelBuf& o = org.get(compID);
+        upscaledPSNR[comp] = upscaledSSD ? 10.0 * log10( (double)maxval * maxval * upscaledWidth * upscaledHeight / (double)upscaledSSD ) : 999.99;
+        upscaledMsssim[comp] = xCalculateMSSSIM (upscaledOrgPB.bufAt(0, 0), upscaledOrgPB.stride, upscaledRecPB.bufAt(0, 0), upscaledRecPB.stride, upscaledWidth, upscaledHeight, bitDepth);
+      }
+      else if (picRefLayer)
+      {
+        const CPelBuf& p = m_pcRefLayerRescaledPicYuv->get(compID);
+        const CPelBuf& o = org.get(compID);
 #if ENABLE_QPA
-      const uint64_t upscaledSSD = xFindDistortionPlane(p, o, useWPSNR ? bitDepth : 0, ::getComponentScaleX(compID, format), ::getComponentScaleY(compID, format));
+        const uint64_t upscaledSSD = xFindDistortionPlane(p, o, useWPSNR ? bitDepth : 0, ::getComponentScaleX(compID, format), ::getComponentScaleY(compID, format));
 #else
-      const uint64_t upscaledSSD = xFindDistortionPlane(p, o, 0);
+        const uint64_t upscaledSSD = xFindDistortionPlane(p, o, 0);
 #endif
-      upscaledPSNR[comp] = upscaledSSD ? 10.0 * log10((double) fRefValue / (double) upscaledSSD) : 999.99;
-      if (printMSSSIM)
-      {
-        const uint32_t upscaledWidth = o.width - ( m_pcEncLib->getSourcePadding( 0 ) >> ::getComponentScaleX( compID, format ) );
-        const uint32_t upscaledHeight = o.height - ( m_pcEncLib->getSourcePadding( 1 ) >> ( !!bPicIsField + ::getComponentScaleY( compID, format ) ) );
-        upscaledMsssim[comp] = xCalculateMSSSIM(o.bufAt(0, 0), o.stride, p.bufAt(0, 0), p.stride, upscaledWidth, upscaledHeight, bitDepth);
+        upscaledPSNR[comp] = upscaledSSD ? 10.0 * log10((double) fRefValue / (double) upscaledSSD) : 999.99;
+        if (printMSSSIM)
+        {
+          const uint32_t upscaledWidth = o.width - ( m_pcEncLib->getSourcePadding( 0 ) >> ::getComponentScaleX( compID, format ) );
+          const uint32_t upscaledHeight = o.height - ( m_pcEncLib->getSourcePadding( 1 ) >> ( !!bPicIsField + ::getComponentScaleY( compID, format ) ) );
+          upscaledMsssim[comp] = xCalculateMSSSIM(o.bufAt(0, 0), o.stride, p.bufAt(0, 0), p.stride, upscaledWidth, upscaledHeight, bitDepth);
+        }
       }
-    }
+    });
   }
+  metricsCounter.wait();
 
 #if EXTENSION_360_VIDEO
   m_ext360.calculatePSNRs(pcPic);
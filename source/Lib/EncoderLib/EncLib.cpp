@@ -65,6 +65,8 @@ EncLib::EncLib(EncLibCommon *encLibCommon)
   , m_lmcsAPS(nullptr)
   , m_scalinglistAPS(nullptr)
   , m_doPlt(true)
+  , m_threadPool(nullptr)
+  , m_lookaheadPool(nullptr)
   , m_vps(encLibCommon->getVPS())
   , m_layerDecPicBuffering(encLibCommon->getDecPicBuffering())
 {
@@ -102,6 +104,17 @@ void EncLib::create( const int layerId )
   // create processing unit classes
   m_cGOPEncoder.        create( );
   m_cCuEncoder.         create( this );
+  if (getNumThreads() > 1)
+  {
+    m_threadPool = new ThreadPool(getNumThreads());
+
+    // the frames are filtered ahead from the input file, which must map to the POCs one to one
+    if ((getGopBasedTemporalFilterEnabled() || getBIM()) && !m_compositeRefEnabled && !isResChangeInClvsEnabled()
+        && !getFieldSeqFlag() && !getShutterFilterFlag() && getTemporalSubsampleRatio() == 1)
+    {
+      m_lookaheadPool = new ThreadPool(1);
+    }
+  }
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   m_cInterSearch.cacheAssign( &m_cacheModel );
 #endif
@@ -147,6 +160,17 @@ void EncLib::destroy ()
   m_cReshaper.          destroy();
   m_cInterSearch.       destroy();
   m_cIntraSearch.destroy();
+
+  m_cSliceEncoder.setThreadPool(nullptr);
+  m_temporalFilter.setLookaheadPool(nullptr);
+  delete m_lookaheadPool;
+  m_lookaheadPool = nullptr;
+  m_temporalFilter.setThreadPool(nullptr);
+  m_temporalFilterForFG.setThreadPool(nullptr);
+  m_cEncSAO.setThreadPool(nullptr);
+  m_cEncALF.setThreadPool(nullptr);
+  delete m_threadPool;
+  m_threadPool = nullptr;
 }
 
 void EncLib::init(AUWriterIf *auWriterIf)
@@ -524,6 +548,15 @@ void EncLib::init(AUWriterIf *auWriterIf)
     picOrig->getOrigBuf().fill(0);
     m_cGOPEncoder.setPicOrig(picOrig);
   }
+
+  // the CU encoders of the pool threads mirror the ones above
+  m_cSliceEncoder.setThreadPool(m_threadPool);
+  m_cSliceEncoder.initCtuEncWorkers(sps0);
+  m_temporalFilter.setThreadPool(m_threadPool);
+  m_temporalFilter.setLookaheadPool(m_lookaheadPool);
+  m_temporalFilterForFG.setThreadPool(m_threadPool);
+  m_cEncSAO.setThreadPool(m_threadPool);
+  m_cEncALF.setThreadPool(m_threadPool);
 }
 
 void EncLib::xInitScalingLists( SPS &sps, APS *aps )
@@ -870,10 +903,28 @@ bool EncLib::encodePrep(bool flush, PelStorage *pcPicYuvOrg, const InputColourSp
   }
 
   m_picIdInGOP = 0;
+  xFilterNextGopAhead();
 
   return false;
 }
 
+void EncLib::xFilterNextGopAhead()
+{
+  if (m_lookaheadPool == nullptr)
+  {
+    return;
+  }
+  // the filtered frames are taken up when the pictures are coded, after they have been received
+  const int endPoc = std::min(m_pocLast + 1 + m_gopSize, getFramesToBeEncoded());
+  for (int poc = m_pocLast + 1; poc < endPoc; poc++)
+  {
+    if (m_temporalFilter.isFilteredFrame(poc))
+    {
+      m_temporalFilter.filterAhead(poc);
+    }
+  }
+}
+
 /**
  - Application has picture buffer list with size of GOP + 1
  - Picture buffer list acts like as ring buffer
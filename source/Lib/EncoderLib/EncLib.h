@@ -71,6 +71,9 @@ class EncLibCommon;
 // ====================================================================================================================
 
 /// encoder class
+/// All state written while coding is owned by an instance: the units of the picture coding structures by the pictures,
+/// the unit pools and search caches by the CU encoders, one per CTU worker. The remaining globals (the ROM tables and
+/// g_pelBufOP) are only written by their one-time initialization, so several instances can encode concurrently.
 class EncLib : public EncCfg
 {
 private:
@@ -124,6 +127,8 @@ private:
   EncHRD                    m_encHRD;
 
   bool                      m_doPlt;
+  ThreadPool*               m_threadPool;                         ///< worker threads of the parallel CTU encoding, temporal filtering, ALF/SAO statistics and quality metrics (nullptr: none)
+  ThreadPool*               m_lookaheadPool;                      ///< thread filtering the frames of the next GOP while the current one is coded (nullptr: none)
 #if JVET_O0756_CALCULATE_HDRMETRICS
   std::chrono::duration<long long, std::ratio<1, 1000000000>> m_metricTime;
 #endif
@@ -166,6 +171,7 @@ protected:
   void  xInitHrdParameters(SPS &sps);                 ///< initialize HRDParameters parameters
 
   void xInitRPL(SPS &sps);   ///< initialize SPS from encoder options
+  void xFilterNextGopAhead(); ///< start the temporal filtering of the frames of the next GOP on the lookahead thread
 
 public:
   EncLib( EncLibCommon* encLibCommon );
@@ -197,6 +203,7 @@ public:
   CABACEncoder*           getCABACEncoder       ()              { return  &m_CABACEncoder;         }
 
   RdCost*                 getRdCost             ()              { return  &m_cRdCost;              }
+  ThreadPool*             getThreadPool         ()              { return  m_threadPool;            }
   CtxPool                *getCtxCache() { return &m_ctxPool; }
   RateCtrl*               getRateCtrl           ()              { return  &m_cRateCtrl;            }
   void                    setRefLayerRescaledAvailable(bool b)  { m_refLayerRescaledAvailable = b; }
@@ -1145,8 +1145,11 @@ void EncModeCtrlMTnoRQT::initCULevel( Partitioner &partitioner, const CodingStru
 
   m_ComprCUCtxList.push_back(ComprCUCtx(cs, minDepth, maxDepth));
 
-  const CodingUnit *cuLeft  = cs.getCU(cs.area.block(partitioner.chType).pos().offset(-1, 0), partitioner.chType);
-  const CodingUnit *cuAbove = cs.getCU(cs.area.block(partitioner.chType).pos().offset(0, -1), partitioner.chType);
+  const Position    pos         = cs.area.block(partitioner.chType).pos();
+  const unsigned    curSliceIdx = cs.slice->getIndependentSliceIdx();
+  const TileIdx     curTileIdx  = cs.pps->getTileIdx(cs.area.lumaPos());
+  const CodingUnit *cuLeft  = cs.getCURestricted(pos.offset(-1, 0), pos, curSliceIdx, curTileIdx, partitioner.chType);
+  const CodingUnit *cuAbove = cs.getCURestricted(pos.offset(0, -1), pos, curSliceIdx, curTileIdx, partitioner.chType);
 
   const bool qtBeforeBt =
     ((cuLeft && cuAbove && cuLeft->qtDepth > partitioner.currQtDepth && cuAbove->qtDepth > partitioner.currQtDepth)
@@ -1964,13 +1967,7 @@ bool EncModeCtrlMTnoRQT::tryMode( const EncTestMode& encTestmode, const CodingSt
     if (cuECtx.get<double>(BEST_NO_IMV_COST) == UNSET_IMV_COST && !slice.isIntra())
 #endif
     {
-      unsigned idx1, idx2, idx3, idx4;
-      getAreaIdx(partitioner.currArea().Y(), *slice.getPPS()->pcv, idx1, idx2, idx3, idx4);
-      CHECKD(idx3 >= MAX_NUM_SIZES || idx4 >= MAX_NUM_SIZES, "MAX_NUM_SIZES is too small");
-      if (g_isReusedUniMVsFilled[idx1][idx2][idx3][idx4])
-      {
-        m_pcInterSearch->insertUniMvCands(partitioner.currArea().Y(), g_reusedUniMVs[idx1][idx2][idx3][idx4]);
-      }
+      m_pcInterSearch->insertReusedUniMvCands(partitioner.currArea().Y(), *slice.getPPS()->pcv);
     }
     if( !bestCS || ( bestCS && isModeSplit( bestMode ) ) )
     {
@@ -253,71 +253,102 @@ void EncSampleAdaptiveOffset::addPreDBFStatistics(std::vector<StatDataArray *> &
 void EncSampleAdaptiveOffset::getStatistics(std::vector<StatDataArray *> &blkStats, PelUnitBuf &orgYuv,
                                             PelUnitBuf &srcYuv, CodingStructure &cs, bool isCalculatePreDeblockSamples)
 {
-  bool isLeftAvail, isRightAvail, isAboveAvail, isBelowAvail, isAboveLeftAvail, isAboveRightAvail;
-
   const PreCalcValues& pcv = *cs.pcv;
-  const int numberOfComponents = getNumberValidComponents(pcv.chrFormat);
 
   size_t lineBufferSize = pcv.maxCUWidth + 1;
-  if (m_signLineBuf1.size() != lineBufferSize)
+  if (m_threadPool == nullptr)
   {
-    m_signLineBuf1.resize(lineBufferSize);
-    m_signLineBuf2.resize(lineBufferSize);
+    if (m_signLineBuf1.size() != lineBufferSize)
+    {
+      m_signLineBuf1.resize(lineBufferSize);
+      m_signLineBuf2.resize(lineBufferSize);
+    }
+
+    for (uint32_t yPos = 0; yPos < pcv.lumaHeight; yPos += pcv.maxCUHeight)
+    {
+      getCtuRowStatistics(blkStats, orgYuv, srcYuv, cs, yPos, isCalculatePreDeblockSamples, m_signLineBuf1.data(),
+                          m_signLineBuf2.data());
+    }
+    return;
   }
 
-  int ctuRsAddr = 0;
-  for( uint32_t yPos = 0; yPos < pcv.lumaHeight; yPos += pcv.maxCUHeight )
+  // the CTU statistics are independent of each other, each CTU row gets its own sign line buffers
+  WaitCounter counter;
+  for (uint32_t yPos = 0; yPos < pcv.lumaHeight; yPos += pcv.maxCUHeight)
   {
-    for( uint32_t xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth )
-    {
-      const uint32_t width  = (xPos + pcv.maxCUWidth  > pcv.lumaWidth)  ? (pcv.lumaWidth - xPos)  : pcv.maxCUWidth;
-      const uint32_t height = (yPos + pcv.maxCUHeight > pcv.lumaHeight) ? (pcv.lumaHeight - yPos) : pcv.maxCUHeight;
-      const UnitArea area( cs.area.chromaFormat, Area(xPos , yPos, width, height) );
+    m_threadPool->addTask(
+      [&, yPos](int)
+      {
+        std::vector<int8_t> signLineBuf1(lineBufferSize);
+        std::vector<int8_t> signLineBuf2(lineBufferSize);
+        getCtuRowStatistics(blkStats, orgYuv, srcYuv, cs, yPos, isCalculatePreDeblockSamples, signLineBuf1.data(),
+                            signLineBuf2.data());
+      },
+      &counter);
+  }
+  counter.wait();
+}
+
+void EncSampleAdaptiveOffset::getCtuRowStatistics(std::vector<StatDataArray *> &blkStats, PelUnitBuf &orgYuv,
+                                                  PelUnitBuf &srcYuv, CodingStructure &cs, const uint32_t yPos,
+                                                  bool isCalculatePreDeblockSamples, int8_t *signLineBuf1,
+                                                  int8_t *signLineBuf2)
+{
+  bool isLeftAvail, isRightAvail, isAboveAvail, isBelowAvail, isAboveLeftAvail, isAboveRightAvail;
 
-      deriveLoopFilterBoundaryAvailability(cs, area.Y(), isLeftAvail, isAboveAvail, isAboveLeftAvail);
+  const PreCalcValues& pcv = *cs.pcv;
+  const int numberOfComponents = getNumberValidComponents(pcv.chrFormat);
 
-      //NOTE: The number of skipped lines during gathering CTU statistics depends on the slice boundary availabilities.
-      //For simplicity, here only picture boundaries are considered.
+  int ctuRsAddr = (yPos / pcv.maxCUHeight) * pcv.widthInCtus;
+  for( uint32_t xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth )
+  {
+    const uint32_t width  = (xPos + pcv.maxCUWidth  > pcv.lumaWidth)  ? (pcv.lumaWidth - xPos)  : pcv.maxCUWidth;
+    const uint32_t height = (yPos + pcv.maxCUHeight > pcv.lumaHeight) ? (pcv.lumaHeight - yPos) : pcv.maxCUHeight;
+    const UnitArea area( cs.area.chromaFormat, Area(xPos , yPos, width, height) );
 
-      isRightAvail      = (xPos + pcv.maxCUWidth  < pcv.lumaWidth );
-      isBelowAvail      = (yPos + pcv.maxCUHeight < pcv.lumaHeight);
-      isAboveRightAvail = ((yPos > 0) && (isRightAvail));
+    deriveLoopFilterBoundaryAvailability(cs, area.Y(), isLeftAvail, isAboveAvail, isAboveLeftAvail);
 
-      int numHorVirBndry = 0, numVerVirBndry = 0;
-      int horVirBndryPos[] = { -1,-1,-1 };
-      int verVirBndryPos[] = { -1,-1,-1 };
-      int horVirBndryPosComp[] = { -1,-1,-1 };
-      int verVirBndryPosComp[] = { -1,-1,-1 };
-      bool isCtuCrossedByVirtualBoundaries = isCrossedByVirtualBoundaries(xPos, yPos, width, height, numHorVirBndry, numVerVirBndry, horVirBndryPos, verVirBndryPos, cs.picHeader );
+    //NOTE: The number of skipped lines during gathering CTU statistics depends on the slice boundary availabilities.
+    //For simplicity, here only picture boundaries are considered.
 
-      for(int compIdx = 0; compIdx < numberOfComponents; compIdx++)
-      {
-        const ComponentID compID = ComponentID(compIdx);
-        const CompArea& compArea = area.block( compID );
+    isRightAvail      = (xPos + pcv.maxCUWidth  < pcv.lumaWidth );
+    isBelowAvail      = (yPos + pcv.maxCUHeight < pcv.lumaHeight);
+    isAboveRightAvail = ((yPos > 0) && (isRightAvail));
 
-        ptrdiff_t srcStride  = srcYuv.get(compID).stride;
-        Pel* srcBlk     = srcYuv.get(compID).bufAt( compArea );
+    int numHorVirBndry = 0, numVerVirBndry = 0;
+    int horVirBndryPos[] = { -1,-1,-1 };
+    int verVirBndryPos[] = { -1,-1,-1 };
+    int horVirBndryPosComp[] = { -1,-1,-1 };
+    int verVirBndryPosComp[] = { -1,-1,-1 };
+    bool isCtuCrossedByVirtualBoundaries = isCrossedByVirtualBoundaries(xPos, yPos, width, height, numHorVirBndry, numVerVirBndry, horVirBndryPos, verVirBndryPos, cs.picHeader );
 
-        ptrdiff_t orgStride  = orgYuv.get(compID).stride;
-        Pel* orgBlk     = orgYuv.get(compID).bufAt( compArea );
+    for(int compIdx = 0; compIdx < numberOfComponents; compIdx++)
+    {
+      const ComponentID compID = ComponentID(compIdx);
+      const CompArea& compArea = area.block( compID );
 
-        for (int i = 0; i < numHorVirBndry; i++)
-        {
-          horVirBndryPosComp[i] = (horVirBndryPos[i] >> ::getComponentScaleY(compID, area.chromaFormat)) - compArea.y;
-        }
-        for (int i = 0; i < numVerVirBndry; i++)
-        {
-          verVirBndryPosComp[i] = (verVirBndryPos[i] >> ::getComponentScaleX(compID, area.chromaFormat)) - compArea.x;
-        }
+      ptrdiff_t srcStride  = srcYuv.get(compID).stride;
+      Pel* srcBlk     = srcYuv.get(compID).bufAt( compArea );
+
+      ptrdiff_t orgStride  = orgYuv.get(compID).stride;
+      Pel* orgBlk     = orgYuv.get(compID).bufAt( compArea );
 
-        getBlkStats(compID, cs.sps->getBitDepth(toChannelType(compID)), blkStats[ctuRsAddr][compID], srcBlk, orgBlk,
-                    srcStride, orgStride, compArea.width, compArea.height, isLeftAvail, isRightAvail, isAboveAvail,
-                    isBelowAvail, isAboveLeftAvail, isAboveRightAvail, isCalculatePreDeblockSamples,
-                    isCtuCrossedByVirtualBoundaries, horVirBndryPosComp, verVirBndryPosComp, numHorVirBndry,
-                    numVerVirBndry);
+      for (int i = 0; i < numHorVirBndry; i++)
+      {
+        horVirBndryPosComp[i] = (horVirBndryPos[i] >> ::getComponentScaleY(compID, area.chromaFormat)) - compArea.y;
+      }
+      for (int i = 0; i < numVerVirBndry; i++)
+      {
+        verVirBndryPosComp[i] = (verVirBndryPos[i] >> ::getComponentScaleX(compID, area.chromaFormat)) - compArea.x;
       }
-      ctuRsAddr++;
+
+      getBlkStats(compID, cs.sps->getBitDepth(toChannelType(compID)), blkStats[ctuRsAddr][compID], srcBlk, orgBlk,
+                  srcStride, orgStride, compArea.width, compArea.height, isLeftAvail, isRightAvail, isAboveAvail,
+                  isBelowAvail, isAboveLeftAvail, isAboveRightAvail, isCalculatePreDeblockSamples,
+                  isCtuCrossedByVirtualBoundaries, horVirBndryPosComp, verVirBndryPosComp, numHorVirBndry,
+                  numVerVirBndry, signLineBuf1, signLineBuf2);
     }
+    ctuRsAddr++;
   }
 }
 
@@ -1133,7 +1164,7 @@ void EncSampleAdaptiveOffset::getBlkStats(const ComponentID compIdx, const int c
                                           bool isAboveLeftAvail, bool isAboveRightAvail,
                                           bool isCalculatePreDeblockSamples, bool isCtuCrossedByVirtualBoundaries,
                                           int horVirBndryPos[], int verVirBndryPos[], int numHorVirBndry,
-                                          int numVerVirBndry)
+                                          int numVerVirBndry, int8_t *signLineBuf1, int8_t *signLineBuf2)
 {
   int x,y, startX, startY, endX, endY, edgeType, firstLineStartX, firstLineEndX;
   int8_t signLeft, signRight, signDown;
@@ -1222,7 +1253,7 @@ void EncSampleAdaptiveOffset::getBlkStats(const ComponentID compIdx, const int c
     {
       diff += 2;
       count += 2;
-      int8_t *signUpLine = m_signLineBuf1.data();
+      int8_t *signUpLine = signLineBuf1;
 
       startX = (!isCalculatePreDeblockSamples) ? 0 : (isRightAvail ? (width - skipLinesR[typeIdx]) : width);
       startY = isAboveAvail ? 0 : 1;
@@ -1299,8 +1330,8 @@ void EncSampleAdaptiveOffset::getBlkStats(const ComponentID compIdx, const int c
       count += 2;
       int8_t *signTmpLine;
 
-      int8_t *signUpLine   = m_signLineBuf1.data();
-      int8_t *signDownLine = m_signLineBuf2.data();
+      int8_t *signUpLine   = signLineBuf1;
+      int8_t *signDownLine = signLineBuf2;
 
       startX = (!isCalculatePreDeblockSamples) ? (isLeftAvail ? 0 : 1)
                                                : (isRightAvail ? (width - skipLinesR[typeIdx]) : (width - 1));
@@ -1397,7 +1428,7 @@ void EncSampleAdaptiveOffset::getBlkStats(const ComponentID compIdx, const int c
     {
       diff += 2;
       count += 2;
-      int8_t *signUpLine = m_signLineBuf1.data();
+      int8_t *signUpLine = signLineBuf1;
 
       startX = (!isCalculatePreDeblockSamples) ? (isLeftAvail ? 0 : 1)
                                                : (isRightAvail ? (width - skipLinesR[typeIdx]) : (width - 1));
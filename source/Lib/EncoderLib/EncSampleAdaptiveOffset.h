@@ -40,6 +40,7 @@
 #define __ENCSAMPLEADAPTIVEOFFSET__
 
 #include "CommonLib/SampleAdaptiveOffset.h"
+#include "CommonLib/ThreadPool.h"
 
 #include "CABACWriter.h"
 
@@ -102,12 +103,16 @@ public:
   void disabledRate(CodingStructure &cs, SAOBlkParam *reconParams, const double saoEncodingRate,
                     const double saoEncodingRateChroma);
   void getPreDBFStatistics(CodingStructure &cs, bool usingTrueOrg);
+  void setThreadPool(ThreadPool *threadPool) { m_threadPool = threadPool; }
 
 private:   // methods
   void deriveLoopFilterBoundaryAvailability(CodingStructure &cs, const Position &pos, bool &isLeftAvail,
                                             bool &isAboveAvail, bool &isAboveLeftAvail) const;
   void getStatistics(std::vector<StatDataArray *> &blkStats, PelUnitBuf &orgYuv, PelUnitBuf &srcYuv,
                      CodingStructure &cs, bool isCalculatePreDeblockSamples = false);
+  void getCtuRowStatistics(std::vector<StatDataArray *> &blkStats, PelUnitBuf &orgYuv, PelUnitBuf &srcYuv,
+                           CodingStructure &cs, const uint32_t yPos, bool isCalculatePreDeblockSamples,
+                           int8_t *signLineBuf1, int8_t *signLineBuf2);
   void decidePicParams(const Slice& slice, bool* sliceEnabled, const double saoEncodingRate, const double saoEncodingRateChroma);
   void decideBlkParams(CodingStructure &cs, bool *sliceEnabled, std::vector<StatDataArray *> &blkStats,
                        PelUnitBuf &srcYuv, PelUnitBuf &resYuv, SAOBlkParam *reconParams, SAOBlkParam *codedParams,
@@ -121,7 +126,8 @@ private:   // methods
                       Pel *orgBlk, ptrdiff_t srcStride, ptrdiff_t orgStride, int width, int height, bool isLeftAvail,
                       bool isRightAvail, bool isAboveAvail, bool isBelowAvail, bool isAboveLeftAvail,
                       bool isAboveRightAvail, bool isCalculatePreDeblockSamples, bool isCtuCrossedByVirtualBoundaries,
-                      int horVirBndryPos[], int verVirBndryPos[], int numHorVirBndry, int numVerVirBndry);
+                      int horVirBndryPos[], int verVirBndryPos[], int numHorVirBndry, int numVerVirBndry,
+                      int8_t *signLineBuf1, int8_t *signLineBuf2);
   void    deriveModeNewRDO(const BitDepths &bitDepths, int ctuRsAddr, MergeBlkParams &mergeList, bool *sliceEnabled,
                            std::vector<StatDataArray *> &blkStats, SAOBlkParam &modeParam, double &modeNormCost);
   void    deriveModeMergeRDO(const BitDepths &bitDepths, int ctuRsAddr, MergeBlkParams &mergeList, bool *sliceEnabled,
@@ -145,6 +151,7 @@ private: //members
   CABACWriter *m_CABACEstimator{ nullptr };
   CtxPool     *m_ctxPool{ nullptr };
   double       m_lambda[MAX_NUM_COMPONENT];
+  ThreadPool  *m_threadPool{ nullptr };   ///< worker threads gathering the CTU statistics (nullptr: none)
 
   //statistics
   std::vector<StatDataArray *> m_statData;   //[ctu][comp][classes]
@@ -56,6 +56,8 @@
 
 EncSlice::EncSlice()
  : m_encCABACTableIdx(I_SLICE)
+ , m_threadPool(nullptr)
+ , m_ctuEncAbort(false)
 #if ENABLE_QPA
  , m_adaptedLumaQP(-1)
 #endif
@@ -74,6 +76,8 @@ void EncSlice::create(int width, int height, ChromaFormat chromaFormat, uint32_t
 
 void EncSlice::destroy()
 {
+  destroyCtuEncWorkers();
+
   // free lambda and QP arrays
   m_vdRdPicLambda.clear();
   m_vdRdPicQp.clear();
@@ -105,6 +109,50 @@ void EncSlice::destroy()
   }
 }
 
+void EncSlice::initCtuEncWorkers( const SPS& sps )
+{
+  destroyCtuEncWorkers();
+
+  const int      numWorkers      = m_threadPool ? m_threadPool->getNumThreads() : 0;
+  const uint32_t maxCUWidth      = m_pcCfg->getMaxCUWidth();
+  const uint32_t maxCUHeight     = m_pcCfg->getMaxCUHeight();
+  const uint32_t maxTotalCUDepth = floorLog2( maxCUWidth ) - m_pcCfg->getLog2MinCodingBlockSize();
+
+  for( int i = 0; i < numWorkers; i++ )
+  {
+    CtuEncWorker *worker = new CtuEncWorker;
+    m_ctuEncWorkers.push_back( worker );
+
+    worker->cuEncoder.create( m_pcCfg );
+    worker->cuEncoder.init( m_pcLib, sps, &worker->intraSearch, &worker->interSearch, &worker->trQuant, &worker->rdCost,
+                            &worker->cabacEncoder, &worker->ctxPool );
+
+    // the scaling lists are shared with the quantizer of the encoder
+    worker->trQuant.init( m_pcTrQuant->getQuant(), 1 << m_pcCfg->getLog2MaxTbSize(), m_pcCfg->getUseRDOQ(),
+                          m_pcCfg->getUseRDOQTS(), m_pcCfg->getUseSelectiveRDOQ(), true );
+
+    CABACWriter *cabacEstimator = worker->cabacEncoder.getCABACEstimator( &sps );
+    worker->intraSearch.init( m_pcCfg, &worker->trQuant, &worker->rdCost, cabacEstimator, &worker->ctxPool, maxCUWidth,
+                              maxCUHeight, maxTotalCUDepth, m_pcLib->getReshaper(), sps.getBitDepth( ChannelType::LUMA ) );
+    worker->interSearch.init( m_pcCfg, &worker->trQuant, m_pcCfg->getSearchRange(), m_pcCfg->getBipredSearchRange(),
+                              m_pcCfg->getMotionEstimationSearchMethod(), m_pcCfg->getUseCompositeRef(), maxCUWidth,
+                              maxCUHeight, maxTotalCUDepth, &worker->rdCost, cabacEstimator, &worker->ctxPool,
+                              m_pcLib->getReshaper() );
+    worker->interSearch.setTempBuffers( worker->intraSearch.getSplitCSBuf(), worker->intraSearch.getFullCSBuf(),
+                                        worker->intraSearch.getSaveCSBuf() );
+  }
+}
+
+void EncSlice::destroyCtuEncWorkers()
+{
+  for( auto worker: m_ctuEncWorkers )
+  {
+    worker->cuEncoder.destroy();
+    delete worker;
+  }
+  m_ctuEncWorkers.clear();
+}
+
 void EncSlice::init( EncLib* pcEncLib, const SPS& sps )
 {
   m_pcCfg             = pcEncLib;
@@ -1354,6 +1402,10 @@ void EncSlice::setSearchRange( Slice* pcSlice )
       int newSearchRange = Clip3(m_pcCfg->getMinSearchWindow(), iMaxSR,
                                  (iMaxSR * ADAPT_SR_SCALE * abs(currPoc - iRefPOC) + offset) / iGOPSize);
       m_pcInterSearch->setAdaptiveSearchRange(dir, refIdx, newSearchRange);
+      for (auto worker: m_ctuEncWorkers)
+      {
+        worker->interSearch.setAdaptiveSearchRange(dir, refIdx, newSearchRange);
+      }
     }
   }
 }
@@ -1604,7 +1656,7 @@ void EncSlice::compressSlice( Picture* pcPic, const bool bCompressEntireSlice, c
 #endif
   m_pcInterSearch->resetAffineMVList();
   m_pcInterSearch->resetUniMvList();
-  ::memset(g_isReusedUniMVsFilled, 0, sizeof(g_isReusedUniMVsFilled));
+  m_pcInterSearch->resetReusedUniMvs();
   encodeCtus( pcPic, bCompressEntireSlice, bFastDeltaQP, m_pcLib );
   if (checkPLTRatio)
   {
@@ -1760,6 +1812,83 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
     }
   }
 
+  if( xUseParallelCtuEncoding( pcPic, pcSlice ) )
+  {
+    // the unit vectors of the picture must not be reallocated while the CTU lines add their units concurrently:
+    // at most a CU, PU and TU per luma and per chroma 4x4 unit of each CTU of the slice are added
+    const size_t maxUnitsPerCtu = 2 * ( pcv.maxCUWidth >> MIN_CU_LOG2 ) * ( pcv.maxCUHeight >> MIN_CU_LOG2 );
+    const size_t maxSliceUnits  = maxUnitsPerCtu * pcSlice->getNumCtuInSlice();
+    cs.cus.reserve( cs.cus.size() + maxSliceUnits );
+    cs.pus.reserve( cs.pus.size() + maxSliceUnits );
+    cs.tus.reserve( cs.tus.size() + maxSliceUnits );
+
+    for( auto worker: m_ctuEncWorkers )
+    {
+      worker->rdCost = *pRdCost;
+      worker->trQuant.getQuant()->setUseScalingList( pTrQuant->getQuant()->getUseScalingList() );
+#if RDOQ_CHROMA_LAMBDA
+      worker->trQuant.setLambdas( pcSlice->getLambdas() );
+#else
+      worker->trQuant.setLambda( pcSlice->getLambdas()[0] );
+#endif
+      EncModeCtrl *modeCtrl = worker->cuEncoder.getModeCtrl();
+      modeCtrl->setFastDeltaQp( bFastDeltaQP );
+      modeCtrl->setPltEnc( m_pcCuEncoder->getModeCtrl()->getPltEnc() );
+      modeCtrl->setUseHashME( m_pcCuEncoder->getModeCtrl()->getUseHashME() );
+      worker->interSearch.setClipMvInSubPic( m_pcInterSearch->getClipMvInSubPic() );
+      if( cs.slice->getSliceType() == B_SLICE )
+      {
+        worker->interSearch.initWeightIdxBits();
+      }
+      if( pcSlice->getSPS()->getUseLmcs() )
+      {
+        worker->cuEncoder.setDecCuReshaperInEncCU( m_pcLib->getReshaper(), pcSlice->getSPS()->getChromaFormatIdc() );
+      }
+    }
+
+    // per CTU copies of the HMVP tables, as CTU lines are compressed concurrently
+    cs.ctuMotionLut.resize( pcv.sizeInCtus );
+
+    m_ctuEncDone.assign( pcv.sizeInCtus, 1 );
+    for( uint32_t ctuIdx = 0; ctuIdx < pcSlice->getNumCtuInSlice(); ctuIdx++ )
+    {
+      m_ctuEncDone[pcSlice->getCtuAddrInSlice( ctuIdx )] = 0;
+    }
+    std::vector<uint32_t> substreamStartCtuIdx;
+    xGetSubstreamStarts( pcSlice, false, substreamStartCtuIdx );
+    m_substreamSyncCtx.resize( substreamStartCtuIdx.size() );
+    m_ctuEncAbort = false;
+
+    // the substreams are queued in slice order, so a substream only ever waits for substreams already taken up by
+    // the pool
+    for( uint32_t substreamIdx = 0; substreamIdx < substreamStartCtuIdx.size(); substreamIdx++ )
+    {
+      const uint32_t startCtuIdx = substreamStartCtuIdx[substreamIdx];
+      const uint32_t endCtuIdx   = substreamIdx + 1 < substreamStartCtuIdx.size()
+                                     ? substreamStartCtuIdx[substreamIdx + 1]
+                                     : pcSlice->getNumCtuInSlice();
+      m_threadPool->addTask( [this, pcPic, startCtuIdx, endCtuIdx, substreamIdx]( int threadIdx )
+                             { xCompressSubstream( pcPic, startCtuIdx, endCtuIdx - startCtuIdx, substreamIdx, threadIdx ); },
+                             &m_ctuEncCounter );
+    }
+    m_ctuEncCounter.wait();
+
+    cs.motionLut = cs.ctuMotionLut[pcSlice->getCtuAddrInSlice( pcSlice->getNumCtuInSlice() - 1 )];
+    cs.ctuMotionLut.clear();
+
+#if K0149_BLOCK_STATISTICS
+    for( uint32_t ctuIdx = 0; ctuIdx < pcSlice->getNumCtuInSlice(); ctuIdx++ )
+    {
+      const uint32_t ctuRsAddr = pcSlice->getCtuAddrInSlice( ctuIdx );
+      const Position pos( ( ctuRsAddr % widthInCtus ) * pcv.maxCUWidth, ( ctuRsAddr / widthInCtus ) * pcv.maxCUHeight );
+      getAndStoreBlockStatistics( cs, UnitArea( cs.area.chromaFormat, Area( pos.x, pos.y, pcv.maxCUWidth, pcv.maxCUHeight ) ) );
+    }
+#endif
+    m_uiPicTotalBits = int( cs.fracBits >> SCALE_BITS );
+    m_uiPicDist      = cs.dist;
+    return;
+  }
+
   // for every CTU in the slice
   for( uint32_t ctuIdx = 0; ctuIdx < pcSlice->getNumCtuInSlice(); ctuIdx++ )
   {
@@ -1919,10 +2048,8 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
       setCTULambdaQpByWeight(ctuIdx, pTrQuant, pRdCost, pcSlice);
     }
 
-    bool updateBcwCodingOrder = cs.slice->getSliceType() == B_SLICE && ctuIdx == 0;
-    if( updateBcwCodingOrder )
+    if( cs.slice->getSliceType() == B_SLICE && ctuIdx == 0 )
     {
-      resetBcwCodingOrder(false, cs);
       m_pcInterSearch->initWeightIdxBits();
     }
     if (pcSlice->getSPS()->getUseLmcs())
@@ -2066,6 +2193,239 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
   }
 }
 
+bool EncSlice::xUseParallelCtuEncoding( const Picture* pic, const Slice* slice ) const
+{
+#if ENABLE_TRACING || JVET_J0090_MEMORY_BANDWITH_MEASURE || GREEN_METADATA_SEI_ENABLED
+  return false;
+#else
+  if( m_ctuEncWorkers.empty() )
+  {
+    return false;
+  }
+  // tools updating picture level state from CTU to CTU, and the CTU debugging, keep the serial CTU order
+  if( m_pcCfg->getUseRateCtrl() || m_pcCfg->getDPF() || m_pcCfg->getMCTSEncConstraint() || m_pcCfg->getUseEncDbOpt()
+      || m_pcCfg->getUsePerceptQPA() || m_pcCfg->getGdrEnabled()
+      || ( m_pcCfg->getSwitchPOC() == pic->getPOC() && m_pcCfg->getDebugCTU() != -1 ) )
+  {
+    return false;
+  }
+#if WCG_EXT && ER_CHROMA_QP_WCG_PPS
+  if( m_pcCfg->getWCGChromaQPControl().isEnabled() )
+  {
+    return false;
+  }
+#endif
+  // palette and IBC predictors are carried from CTU to CTU on picture level, subpictures pad the references per slice
+  if( slice->getSPS()->getPLTMode() || slice->getSPS()->getIBCFlag() || slice->getPPS()->getNumSubPics() >= 2 )
+  {
+    return false;
+  }
+  // the substreams are handed to the workers as a whole, starting from the first CTU column of a tile
+  if( !slice->getPPS()->ctuIsTileColBd( slice->getCtuAddrInSlice( 0 ) % slice->getPPS()->pcv->widthInCtus ) )
+  {
+    return false;
+  }
+  std::vector<uint32_t> substreamStartCtuIdx;
+  xGetSubstreamStarts( slice, false, substreamStartCtuIdx );
+  return substreamStartCtuIdx.size() > 1;
+#endif
+}
+
+void EncSlice::xGetSubstreamStarts( const Slice* slice, bool tilesOnly, std::vector<uint32_t>& startCtuIdx ) const
+{
+  const PPS     &pps               = *slice->getPPS();
+  const bool     wavefrontsEnabled = !tilesOnly && slice->getSPS()->getEntropyCodingSyncEnabledFlag();
+  const unsigned widthInCtus       = pps.pcv->widthInCtus;
+
+  startCtuIdx.clear();
+  for( uint32_t ctuIdx = 0; ctuIdx < slice->getNumCtuInSlice(); ctuIdx++ )
+  {
+    const uint32_t ctuRsAddr     = slice->getCtuAddrInSlice( ctuIdx );
+    const uint32_t ctuXPosInCtus = ctuRsAddr % widthInCtus;
+    const uint32_t ctuYPosInCtus = ctuRsAddr / widthInCtus;
+
+    // substreams start with the slice, with each tile and, with wavefronts, with each CTU line of a tile
+    if( ctuIdx == 0
+        || ( pps.ctuIsTileColBd( ctuXPosInCtus ) && ( wavefrontsEnabled || pps.ctuIsTileRowBd( ctuYPosInCtus ) ) ) )
+    {
+      startCtuIdx.push_back( ctuIdx );
+    }
+  }
+}
+
+void EncSlice::xCompressSubstream( Picture* pic, unsigned startCtuIdx, unsigned numCtus, unsigned substreamIdx, int threadIdx )
+{
+  CtuEncWorker        &worker = *m_ctuEncWorkers[threadIdx];
+  CodingStructure     &cs     = *pic->cs;
+  Slice               *slice  = cs.slice;
+  const PPS           &pps    = *slice->getPPS();
+  const SPS           &sps    = *slice->getSPS();
+  const PreCalcValues &pcv    = *cs.pcv;
+
+  const unsigned widthInCtus    = pcv.widthInCtus;
+  CABACWriter   *cabacEstimator = worker.cabacEncoder.getCABACEstimator( &sps );
+
+  try
+  {
+    // the search state carried from CTU to CTU starts anew with each substream, so that the result does not depend
+    // on which substreams a worker thread happened to compress before
+    worker.interSearch.resetAffineMVList();
+    worker.interSearch.resetUniMvList();
+    worker.interSearch.resetReusedUniMvs();
+
+    EnumArray<int, ChannelType> prevQP;
+    EnumArray<int, ChannelType> currQP;
+    prevQP.fill( slice->getSliceQp() );
+    currQP.fill( slice->getSliceQp() );
+
+    for( unsigned ctuIdx = startCtuIdx; ctuIdx < startCtuIdx + numCtus; ctuIdx++ )
+    {
+      const unsigned ctuRsAddr      = slice->getCtuAddrInSlice( ctuIdx );
+      const unsigned ctuXPosInCtus  = ctuRsAddr % widthInCtus;
+      const unsigned ctuYPosInCtus  = ctuRsAddr / widthInCtus;
+      const unsigned tileColIdx     = pps.ctuToTileCol( ctuXPosInCtus );
+      const unsigned tileXPosInCtus = pps.getTileColumnBd( tileColIdx );
+      const unsigned tileYPosInCtus = pps.getTileRowBd( pps.ctuToTileRow( ctuYPosInCtus ) );
+      const unsigned tileColWidth   = pps.getTileColumnWidth( tileColIdx );
+
+      // the CU search may reference the CTUs up to the above-right one
+      const bool     hasAbove    = ctuYPosInCtus > tileYPosInCtus;
+      const unsigned aboveRsAddr = hasAbove ? ( ctuYPosInCtus - 1 ) * widthInCtus
+                                                + std::min( ctuXPosInCtus + 1, tileXPosInCtus + tileColWidth - 1 )
+                                            : 0;
+      {
+        std::unique_lock<std::mutex> lock( m_ctuEncMutex );
+        m_ctuEncCond.wait( lock, [&] { return m_ctuEncAbort || !hasAbove || m_ctuEncDone[aboveRsAddr]; } );
+        if( m_ctuEncAbort )
+        {
+          return;
+        }
+      }
+
+      const Position pos( ctuXPosInCtus * pcv.maxCUWidth, ctuYPosInCtus * pcv.maxCUHeight );
+      const UnitArea ctuArea( cs.area.chromaFormat, Area( pos.x, pos.y, pcv.maxCUWidth, pcv.maxCUHeight ) );
+
+      LutMotionCand &motionLut = cs.ctuMotionLut[ctuRsAddr];
+      if( ctuXPosInCtus == tileXPosInCtus )
+      {
+        motionLut.lut.resize( 0 );
+        motionLut.lutIbc.resize( 0 );
+      }
+      else
+      {
+        motionLut = cs.ctuMotionLut[ctuRsAddr - 1];
+      }
+      if( ctuIdx == startCtuIdx )
+      {
+        // reset and then, with wavefronts, update contexts to the state at the end of the top CTU (if within current
+        // slice and tile), which is the first CTU of the previous substream
+        cabacEstimator->initCtxModels( *slice );
+        if( sps.getEntropyCodingSyncEnabledFlag() && hasAbove
+            && cs.getCURestricted( pos.offset( 0, -1 ), pos, slice->getIndependentSliceIdx(), pps.getTileIdx( pos ),
+                                   ChannelType::LUMA ) )
+        {
+          cabacEstimator->getCtx() = m_substreamSyncCtx[substreamIdx - 1];
+          cabacEstimator->getCtx().riceStatReset(
+            sps.getBitDepth( ChannelType::LUMA ), sps.getSpsRangeExtension().getPersistentRiceAdaptationEnabledFlag() );
+        }
+        prevQP.fill( slice->getSliceQp() );
+      }
+
+      worker.cuEncoder.compressCtu( cs, ctuArea, ctuRsAddr, prevQP, currQP );
+
+      cabacEstimator->resetBits();
+      cabacEstimator->coding_tree_unit( cs, ctuArea, prevQP, ctuRsAddr, true, true );
+      const int numberOfWrittenBits = int( cabacEstimator->getEstFracBits() >> SCALE_BITS );
+
+      if( ctuIdx == startCtuIdx )
+      {
+        m_substreamSyncCtx[substreamIdx] = cabacEstimator->getCtx();
+      }
+
+      {
+        std::unique_lock<std::mutex> lock( m_ctuEncMutex );
+        m_ctuEncDone[ctuRsAddr] = 1;
+        slice->setSliceBits( ( uint32_t ) ( slice->getSliceBits() + numberOfWrittenBits ) );
+      }
+      m_ctuEncCond.notify_all();
+    }
+  }
+  catch( ... )
+  {
+    {
+      std::unique_lock<std::mutex> lock( m_ctuEncMutex );
+      m_ctuEncAbort = true;
+    }
+    m_ctuEncCond.notify_all();
+    throw;
+  }
+}
+
+void EncSlice::xEncodeTile( Picture* pic, CABACWriter* cabacWriter, unsigned startCtuIdx, unsigned numCtus,
+                            OutputBitstream* substreams, uint32_t& numBinsCoded )
+{
+  CodingStructure     &cs                = *pic->cs;
+  const Slice         &slice             = *cs.slice;
+  const PPS           &pps               = *slice.getPPS();
+  const SPS           &sps               = *slice.getSPS();
+  const PreCalcValues &pcv               = *cs.pcv;
+  const bool           wavefrontsEnabled = sps.getEntropyCodingSyncEnabledFlag();
+
+  EnumArray<int, ChannelType> prevQP;
+  Ctx                         syncCtx;
+  unsigned                    substreamIdx = 0;
+
+  prevQP.fill( slice.getSliceQp() );
+  cabacWriter->initCtxModels( slice );
+  numBinsCoded = 0;
+
+  for( unsigned ctuIdx = startCtuIdx; ctuIdx < startCtuIdx + numCtus; ctuIdx++ )
+  {
+    const uint32_t ctuRsAddr     = slice.getCtuAddrInSlice( ctuIdx );
+    const uint32_t ctuXPosInCtus = ctuRsAddr % pcv.widthInCtus;
+    const uint32_t ctuYPosInCtus = ctuRsAddr / pcv.widthInCtus;
+    const bool     isLineStart   = wavefrontsEnabled && pps.ctuIsTileColBd( ctuXPosInCtus );
+
+    const Position pos( ctuXPosInCtus * pcv.maxCUWidth, ctuYPosInCtus * pcv.maxCUHeight );
+    const UnitArea ctuArea( cs.area.chromaFormat, Area( pos.x, pos.y, pcv.maxCUWidth, pcv.maxCUHeight ) );
+    cabacWriter->initBitstream( &substreams[substreamIdx] );
+
+    if( isLineStart && ctuIdx != startCtuIdx )
+    {
+      // Synchronize cabac probabilities with upper CTU if it's available and at the start of a line.
+      numBinsCoded += cabacWriter->getNumBins();
+      cabacWriter->initCtxModels( slice );
+      if( cs.getCURestricted( pos.offset( 0, -1 ), pos, slice.getIndependentSliceIdx(), pps.getTileIdx( pos ),
+                              ChannelType::LUMA ) )
+      {
+        cabacWriter->getCtx() = syncCtx;
+        cabacWriter->getCtx().riceStatReset(
+          sps.getBitDepth( ChannelType::LUMA ), sps.getSpsRangeExtension().getPersistentRiceAdaptationEnabledFlag() );
+      }
+      prevQP.fill( slice.getSliceQp() );
+    }
+
+    cabacWriter->coding_tree_unit( cs, ctuArea, prevQP, ctuRsAddr );
+
+    if( isLineStart )
+    {
+      syncCtx = cabacWriter->getCtx();
+    }
+
+    // terminate the substream at the end of the tile and, with wavefronts, at the end of each CTU line of the tile
+    const bool isLastCtuInTile = ctuIdx + 1 == startCtuIdx + numCtus;
+    const bool isLastCtuInLine = !isLastCtuInTile && wavefrontsEnabled
+                                 && pps.ctuIsTileColBd( slice.getCtuAddrInSlice( ctuIdx + 1 ) % pcv.widthInCtus );
+    if( isLastCtuInTile || isLastCtuInLine )
+    {
+      cabacWriter->end_of_slice();
+      substreams[substreamIdx].writeByteAlignment();
+      substreamIdx++;
+    }
+  }
+  numBinsCoded += cabacWriter->getNumBins();
+}
+
 void EncSlice::encodeSlice   ( Picture* pcPic, OutputBitstream* pcSubstreams, uint32_t &numBinsCoded )
 {
 
@@ -2090,6 +2450,91 @@ void EncSlice::encodeSlice   ( Picture* pcPic, OutputBitstream* pcSubstreams, ui
   const uint32_t widthInCtus   = pcv.widthInCtus;
   uint32_t uiSubStrm = 0;
 
+#if !( ENABLE_TRACING || JVET_J0090_MEMORY_BANDWITH_MEASURE || GREEN_METADATA_SEI_ENABLED )
+  // the tiles of the slice are written concurrently into their substreams, unless the palette predictor or the rice
+  // parameter statistics are carried from tile to tile
+  std::vector<uint32_t> tileStartCtuIdx;
+  xGetSubstreamStarts( pcSlice, true, tileStartCtuIdx );
+  if( !m_ctuEncWorkers.empty() && tileStartCtuIdx.size() > 1 && !pcSlice->getSPS()->getPLTMode()
+      && !pcSlice->getSPS()->getSpsRangeExtension().getTSRCRicePresentFlag() )
+  {
+    std::vector<uint32_t> substreamStartCtuIdx;
+    xGetSubstreamStarts( pcSlice, false, substreamStartCtuIdx );
+
+    const size_t          numTiles = tileStartCtuIdx.size();
+    std::vector<uint32_t> tileNumBinsCoded( numTiles, 0 );
+    std::exception_ptr    lastTileException;
+    uint32_t              tileFirstSubstream = 0;
+
+    for( size_t tileIdx = 0; tileIdx < numTiles; tileIdx++ )
+    {
+      const uint32_t startCtuIdx = tileStartCtuIdx[tileIdx];
+      const uint32_t endCtuIdx   = tileIdx + 1 < numTiles ? tileStartCtuIdx[tileIdx + 1] : pcSlice->getNumCtuInSlice();
+      while( substreamStartCtuIdx[tileFirstSubstream] < startCtuIdx )
+      {
+        tileFirstSubstream++;
+      }
+      OutputBitstream *tileSubstreams = &pcSubstreams[tileFirstSubstream];
+      uint32_t        &numBins        = tileNumBinsCoded[tileIdx];
+
+      if( tileIdx + 1 < numTiles )
+      {
+        m_threadPool->addTask(
+          [this, pcPic, startCtuIdx, endCtuIdx, tileSubstreams, &numBins]( int threadIdx )
+          {
+            CABACWriter *cabacWriter = m_ctuEncWorkers[threadIdx]->cabacEncoder.getCABACWriter( pcPic->cs->sps );
+            xEncodeTile( pcPic, cabacWriter, startCtuIdx, endCtuIdx - startCtuIdx, tileSubstreams, numBins );
+          },
+          &m_ctuEncCounter );
+      }
+      else
+      {
+        // the last tile is written by the own writer, its final state selects the CABAC table of the next slices
+        try
+        {
+          xEncodeTile( pcPic, m_CABACWriter, startCtuIdx, endCtuIdx - startCtuIdx, tileSubstreams, numBins );
+        }
+        catch( ... )
+        {
+          lastTileException = std::current_exception();
+        }
+      }
+    }
+    m_ctuEncCounter.wait();
+    if( lastTileException )
+    {
+      std::rethrow_exception( lastTileException );
+    }
+
+    // the sizes of all but the last substream are signalled as entry points, in slice order
+    for( uint32_t substreamIdx = 0; substreamIdx + 1 < substreamStartCtuIdx.size(); substreamIdx++ )
+    {
+      substreamSize += ( pcSubstreams[substreamIdx].getNumberOfWrittenBits() >> 3 )
+                       + pcSubstreams[substreamIdx].countStartCodeEmulations();
+      pcSlice->increaseNumberOfSubstream();
+      if( entryPointsPresentFlag )
+      {
+        pcSlice->addSubstreamSize( substreamSize );
+        substreamSize = 0;
+      }
+    }
+
+    if( pcSlice->getPPS()->getCabacInitPresentFlag() )
+    {
+      m_encCABACTableIdx = m_CABACWriter->getCtxInitId( *pcSlice );
+    }
+    else
+    {
+      m_encCABACTableIdx = pcSlice->getSliceType();
+    }
+    for( auto tileBins: tileNumBinsCoded )
+    {
+      numBinsCoded += tileBins;
+    }
+    return;
+  }
+#endif
+
   // for every CTU in the slice...
   for( uint32_t ctuIdx = 0; ctuIdx < pcSlice->getNumCtuInSlice(); ctuIdx++ )
   {
@@ -2134,12 +2579,6 @@ void EncSlice::encodeSlice   ( Picture* pcPic, OutputBitstream* pcSubstreams, ui
       }
     }
 
-    bool updateBcwCodingOrder = cs.slice->getSliceType() == B_SLICE && ctuIdx == 0;
-    if( updateBcwCodingOrder )
-    {
-      resetBcwCodingOrder(false, cs);
-    }
-
     m_CABACWriter->coding_tree_unit( cs, ctuArea, pcPic->m_prevQP, ctuRsAddr );
 
     // store probabilities of first CTU in line into buffer
@@ -45,6 +45,10 @@
 
 #include "CommonLib/CommonDef.h"
 #include "CommonLib/Picture.h"
+#include "CommonLib/ThreadPool.h"
+
+#include <condition_variable>
+#include <mutex>
 
 //! \ingroup EncoderLib
 //! \{
@@ -56,6 +60,18 @@ class EncGOP;
 // Class definition
 // ====================================================================================================================
 
+/// CU encoding objects owned by one worker thread of the parallel CTU encoding
+struct CtuEncWorker
+{
+  TrQuant      trQuant;
+  RdCost       rdCost;
+  CABACEncoder cabacEncoder;
+  CtxPool      ctxPool;
+  IntraSearch  intraSearch;
+  InterSearch  interSearch;
+  EncCu        cuEncoder;
+};
+
 /// slice encoder class
 class EncSlice
   : public WeightPredAnalysis
@@ -97,6 +113,23 @@ private:
   int                     m_gopID;
 #endif
 
+  // parallel CTU encoding: the substreams of a slice (the CTU lines of wavefront parallel slices, else the tiles)
+  // are compressed concurrently by the pool, the tiles of a slice are also written concurrently
+  ThreadPool*                m_threadPool;
+  std::vector<CtuEncWorker*> m_ctuEncWorkers;          ///< one per pool thread
+  WaitCounter                m_ctuEncCounter;
+  std::mutex                 m_ctuEncMutex;
+  std::condition_variable    m_ctuEncCond;
+  std::vector<char>          m_ctuEncDone;             ///< per CTU in raster scan order
+  std::vector<Ctx>           m_substreamSyncCtx;       ///< context states after the first CTU of each substream of the slice
+  bool                       m_ctuEncAbort;
+
+  bool    xUseParallelCtuEncoding( const Picture* pic, const Slice* slice ) const;
+  void    xGetSubstreamStarts    ( const Slice* slice, bool tilesOnly, std::vector<uint32_t>& startCtuIdx ) const;
+  void    xCompressSubstream     ( Picture* pic, unsigned startCtuIdx, unsigned numCtus, unsigned substreamIdx, int threadIdx );
+  void    xEncodeTile            ( Picture* pic, CABACWriter* cabacWriter, unsigned startCtuIdx, unsigned numCtus,
+                                   OutputBitstream* substreams, uint32_t& numBinsCoded );
+
 public:
   double initializeLambda(const Slice *slice, const int gopId, const int refQP,
                           const double dQP);   // called by calculateLambda() and updateLambda()
@@ -118,6 +151,12 @@ public:
   void    destroy             ();
   void    init                ( EncLib* pcEncLib, const SPS& sps );
 
+  /// enables parallel CTU encoding on the given pool (nullptr: single-threaded)
+  void    setThreadPool       ( ThreadPool* threadPool ) { m_threadPool = threadPool; }
+  /// creates the per-thread CU encoding objects, after the encoder's own objects are initialized
+  void    initCtuEncWorkers   ( const SPS& sps );
+  void    destroyCtuEncWorkers();
+
   /// preparation of slice encoding (reference marking, QP and lambda)
   void initEncSlice(Picture *pcPic, const int pocLast, const int pocCurr, const int gopId, Slice *&rpcSlice,
                     const bool isField, bool isEncodeLtRef, int layerId, NalUnitType nalType);
@@ -88,6 +88,8 @@ EncTemporalFilter::EncTemporalFilter()
   , m_QP(0)
   , m_clipInputVideoToRec709Range(false)
   , m_inputColourSpaceConvert(NUMBER_INPUT_COLOUR_SPACE_CONVERSIONS)
+  , m_threadPool(nullptr)
+  , m_lookaheadPool(nullptr)
 {}
 
 void EncTemporalFilter::init(const int frameSkip, const BitDepths &inputBitDepth, const BitDepths &msbExtendedBitDepth,
@@ -141,225 +143,353 @@ void EncTemporalFilter::init(const int frameSkip, const BitDepths &inputBitDepth
 
 bool EncTemporalFilter::filter(PelStorage *orgPic, int receivedPoc)
 {
-  bool isFilterThisFrame = false;
-  if (m_QP >= 17)  // disable filter for QP < 17
+  if (!isFilteredFrame(receivedPoc))
   {
-    for (std::map<int, double>::iterator it = m_temporalFilterStrengths.begin(); it != m_temporalFilterStrengths.end();
-         ++it)
+    return false;
+  }
+
+  int       *qpMap      = nullptr;
+  const bool isFiltered = filterFrame(*orgPic, receivedPoc, qpMap);
+  if (qpMap != nullptr)
+  {
+    m_ctuAdaptedQP->insert({ receivedPoc, qpMap });
+  }
+  return isFiltered;
+}
+
+bool EncTemporalFilter::isFilteredFrame(const int receivedPoc) const
+{
+  if (m_QP < 17)  // disable filter for QP < 17
+  {
+    return false;
+  }
+  for (std::map<int, double>::const_iterator it = m_temporalFilterStrengths.begin();
+       it != m_temporalFilterStrengths.end(); ++it)
+  {
+    int filteredFrame = it->first;
+    if (receivedPoc % filteredFrame == 0)
     {
-      int filteredFrame = it->first;
-      if (receivedPoc % filteredFrame == 0)
+      return true;
+    }
+  }
+  return false;
+}
+
+void EncTemporalFilter::filterAhead(const int receivedPoc)
+{
+  CHECK(m_lookaheadPool == nullptr, "No lookahead pool");
+  if (m_filteredAhead.count(receivedPoc) != 0)
+  {
+    return;
+  }
+
+  FilteredAheadPic *filteredAhead = new FilteredAheadPic;
+  m_filteredAhead[receivedPoc].reset(filteredAhead);
+
+  m_lookaheadPool->addTask(
+    [this, filteredAhead, receivedPoc](int)
+    {
+      // the original is read from the input file, as the picture may not have been received yet
+      VideoIOYuv yuvFrames;
+      yuvFrames.open(m_inputFileName, false, m_inputBitDepth, m_msbExtendedBitDepth, m_internalBitDepth);
+      skipFrames(yuvFrames, receivedPoc + m_frameSkip);
+      filteredAhead->orgPic.create(m_chromaFormatIdc, m_area);
+      const bool readOk = readFrame(yuvFrames, filteredAhead->orgPic);
+      yuvFrames.close();
+      if (!readOk)
       {
-        isFilterThisFrame = true;
-        break;
+        filteredAhead->orgPic.destroy();
+        return;
       }
+      filteredAhead->filteredPic.create(m_chromaFormatIdc, m_area);
+      filteredAhead->filteredPic.copyFrom(filteredAhead->orgPic);
+      filteredAhead->isFiltered = filterFrame(filteredAhead->filteredPic, receivedPoc, filteredAhead->qpMap);
+    },
+    &filteredAhead->done);
+}
+
+bool EncTemporalFilter::takeFilteredAhead(PelStorage *orgPic, const int receivedPoc)
+{
+  auto it = m_filteredAhead.find(receivedPoc);
+  if (it == m_filteredAhead.end())
+  {
+    return false;
+  }
+  std::unique_ptr<FilteredAheadPic> filteredAhead = std::move(it->second);
+  m_filteredAhead.erase(it);
+  filteredAhead->done.wait();
+
+  // the received original may differ from the frame in the file, e.g. when the input was converted on reading
+  bool isSameOrg = !filteredAhead->orgPic.bufs.empty();
+  for (int c = 0; isSameOrg && c < getNumberValidComponents(m_chromaFormatIdc); c++)
+  {
+    const CPelBuf aheadBuf = filteredAhead->orgPic.bufs[c];
+    const CPelBuf orgBuf   = orgPic->bufs[c];
+    isSameOrg              = aheadBuf.width == orgBuf.width && aheadBuf.height == orgBuf.height;
+    for (int y = 0; isSameOrg && y < orgBuf.height; y++)
+    {
+      isSameOrg = std::equal(orgBuf.bufAt(0, y), orgBuf.bufAt(0, y) + orgBuf.width, aheadBuf.bufAt(0, y));
     }
   }
+  if (!isSameOrg)
+  {
+    delete[] filteredAhead->qpMap;
+    return false;
+  }
 
-  if (isFilterThisFrame)
+  if (filteredAhead->qpMap != nullptr)
+  {
+    m_ctuAdaptedQP->insert({ receivedPoc, filteredAhead->qpMap });
+  }
+  if (filteredAhead->isFiltered && m_mctfEnabled)
+  {
+    orgPic->copyFrom(filteredAhead->filteredPic);
+  }
+  return true;
+}
+
+void EncTemporalFilter::setLookaheadPool(ThreadPool *lookaheadPool)
+{
+  for (auto &filteredAhead: m_filteredAhead)
   {
-    const int  currentFilePoc = receivedPoc + m_frameSkip;
-    const int  firstFrame     = std::max(currentFilePoc - m_pastRefs, m_firstValidFrame);
-    const int  lastFrame      = std::min(currentFilePoc + m_futureRefs, m_lastValidFrame);
-    VideoIOYuv yuvFrames;
-    yuvFrames.open(m_inputFileName, false, m_inputBitDepth, m_msbExtendedBitDepth, m_internalBitDepth);
-    if (m_sourceWidthBeforeScale != 0 && m_sourceHeightBeforeScale != 0)
+    try
     {
-      yuvFrames.skipFrames(firstFrame, m_sourceWidthBeforeScale, m_sourceHeightBeforeScale, m_chromaFormatIdc);
+      filteredAhead.second->done.wait();
     }
-    else
+    catch (...)
     {
-      yuvFrames.skipFrames(firstFrame, m_sourceWidth - m_pad[0], m_sourceHeight - m_pad[1], m_chromaFormatIdc);
+      // the results are dropped anyway
     }
+    delete[] filteredAhead.second->qpMap;
+  }
+  m_filteredAhead.clear();
+  m_lookaheadPool = lookaheadPool;
+}
 
-    std::deque<TemporalFilterSourcePicInfo> srcFrameInfo;
+// ====================================================================================================================
+// Private member functions
+// ====================================================================================================================
 
-    // subsample original picture so it only needs to be done once
-    PelStorage origPadded;
+bool EncTemporalFilter::filterFrame(PelStorage &orgPic, const int receivedPoc, int *&qpMap) const
+{
+  const int  currentFilePoc = receivedPoc + m_frameSkip;
+  const int  firstFrame     = std::max(currentFilePoc - m_pastRefs, m_firstValidFrame);
+  const int  lastFrame      = std::min(currentFilePoc + m_futureRefs, m_lastValidFrame);
+  VideoIOYuv yuvFrames;
+  yuvFrames.open(m_inputFileName, false, m_inputBitDepth, m_msbExtendedBitDepth, m_internalBitDepth);
+  skipFrames(yuvFrames, firstFrame);
 
-    origPadded.create(m_chromaFormatIdc, m_area, 0, m_padding);
-    origPadded.copyFrom(*orgPic);
-    origPadded.extendBorderPel(m_padding, m_padding);
+  std::deque<TemporalFilterSourcePicInfo> srcFrameInfo;
 
-    PelStorage origSubsampled2;
-    PelStorage origSubsampled4;
+  // subsample original picture so it only needs to be done once
+  PelStorage origPadded;
 
-    subsampleLuma(origPadded, origSubsampled2);
-    subsampleLuma(origSubsampled2, origSubsampled4);
+  origPadded.create(m_chromaFormatIdc, m_area, 0, m_padding);
+  origPadded.copyFrom(orgPic);
+  origPadded.extendBorderPel(m_padding, m_padding);
 
-    // determine motion vectors
-    for (int poc = firstFrame; poc <= lastFrame; poc++)
-    {
-      if (poc == currentFilePoc)
-      { // hop over frame that will be filtered
-        if (m_sourceWidthBeforeScale != 0 && m_sourceHeightBeforeScale != 0)
-        {
-          yuvFrames.skipFrames(1, m_sourceWidthBeforeScale, m_sourceHeightBeforeScale, m_chromaFormatIdc);
-        }
-        else
-        {
-          yuvFrames.skipFrames(1, m_sourceWidth - m_pad[0], m_sourceHeight - m_pad[1], m_chromaFormatIdc);
-        }
-        continue;
-      }
-      srcFrameInfo.push_back(TemporalFilterSourcePicInfo());
-      TemporalFilterSourcePicInfo &srcPic = srcFrameInfo.back();
-
-      PelStorage dummyPicBufferTO; // Only used temporary in yuvFrames.read
-      srcPic.picBuffer.create(m_chromaFormatIdc, m_area, 0, m_padding);
-      bool readOk = false;
-      if (m_sourceWidthBeforeScale != 0 && m_sourceHeightBeforeScale != 0)
-      {
-        Area areaPrescale(0, 0, m_sourceWidthBeforeScale, m_sourceHeightBeforeScale);
-        PelStorage m_orgPicBeforeScale;
-        m_orgPicBeforeScale.create(m_chromaFormatIdc, areaPrescale, 0, m_padding);
-        dummyPicBufferTO.create(m_chromaFormatIdc, areaPrescale, 0, m_padding);
-        readOk = yuvFrames.read(m_orgPicBeforeScale, dummyPicBufferTO, m_inputColourSpaceConvert, m_pad, m_chromaFormatIdc,
-          m_clipInputVideoToRec709Range);
-        if (readOk)
-        {
-          int w0 = m_sourceWidthBeforeScale;
-          int h0 = m_sourceHeightBeforeScale;
-          int w1 = m_sourceWidth - m_pad[0];
-          int h1 = m_sourceHeight - m_pad[1];
-          int xScale = ((w0 << ScalingRatio::BITS) + (w1 >> 1)) / w1;
-          int yScale = ((h0 << ScalingRatio::BITS) + (h1 >> 1)) / h1;
-          ScalingRatio scalingRatio = { xScale, yScale };
-          Window conformanceWindow1(0, m_pad[0] / SPS::getWinUnitX(m_chromaFormatIdc), 0, m_pad[1] / SPS::getWinUnitY(m_chromaFormatIdc));
-
-          bool downsampling = (m_sourceWidthBeforeScale > m_sourceWidth) || (m_sourceHeightBeforeScale > m_sourceHeight);
-          bool useLumaFilter = downsampling;
-          Picture::rescalePicture(scalingRatio, m_orgPicBeforeScale, Window(), srcPic.picBuffer, conformanceWindow1,
-            m_chromaFormatIdc, m_internalBitDepth, useLumaFilter, downsampling,
-            m_sourceHorCollocatedChromaFlag != 0, m_sourceVerCollocatedChromaFlag != 0);
-        }
-      }
-      else
-      {
-        dummyPicBufferTO.create(m_chromaFormatIdc, m_area, 0, m_padding);
-        readOk = yuvFrames.read(srcPic.picBuffer, dummyPicBufferTO, m_inputColourSpaceConvert, m_pad, m_chromaFormatIdc,
-          m_clipInputVideoToRec709Range);
-      }
+  PelStorage origSubsampled2;
+  PelStorage origSubsampled4;
 
-      if(!readOk)
-      {
-        // eof or read fail
-        srcPic.picBuffer.destroy();
-        srcFrameInfo.pop_back();
-        break;
-      }
-      srcPic.picBuffer.extendBorderPel(m_padding, m_padding);
-      srcPic.mvs.allocate(m_sourceWidth / 4, m_sourceHeight / 4);
+  subsampleLuma(origPadded, origSubsampled2);
+  subsampleLuma(origSubsampled2, origSubsampled4);
 
-      motionEstimation(srcPic.mvs, origPadded, srcPic.picBuffer, origSubsampled2, origSubsampled4);
-      srcPic.origOffset = poc - currentFilePoc;
+  // read the references
+  for (int poc = firstFrame; poc <= lastFrame; poc++)
+  {
+    if (poc == currentFilePoc)
+    { // hop over frame that will be filtered
+      skipFrames(yuvFrames, 1);
+      continue;
     }
+    srcFrameInfo.push_back(TemporalFilterSourcePicInfo());
+    TemporalFilterSourcePicInfo &srcPic = srcFrameInfo.back();
 
-    const int numRefs = int(srcFrameInfo.size());
-    if (numRefs == 0)
+    srcPic.picBuffer.create(m_chromaFormatIdc, m_area, 0, m_padding);
+    const bool readOk = readFrame(yuvFrames, srcPic.picBuffer);
+
+    if(!readOk)
     {
-      yuvFrames.close();
-      return false;
+      // eof or read fail
+      srcPic.picBuffer.destroy();
+      srcFrameInfo.pop_back();
+      break;
     }
+    srcPic.picBuffer.extendBorderPel(m_padding, m_padding);
+    srcPic.mvs.allocate(m_sourceWidth / 4, m_sourceHeight / 4);
+    srcPic.origOffset = poc - currentFilePoc;
+  }
 
-    // filter
-    PelStorage newOrgPic;
-    newOrgPic.create(m_chromaFormatIdc, m_area, 0, m_padding);
-    double overallStrength = -1.0;
-    for (std::map<int, double>::iterator it = m_temporalFilterStrengths.begin(); it != m_temporalFilterStrengths.end();
-         ++it)
+  const int numRefs = int(srcFrameInfo.size());
+  if (numRefs == 0)
+  {
+    yuvFrames.close();
+    return false;
+  }
+
+  // determine motion vectors, the references are independent of each other
+  auto estimateMotion = [&](int refIdx)
+  {
+    TemporalFilterSourcePicInfo &srcPic = srcFrameInfo[refIdx];
+    motionEstimation(srcPic.mvs, origPadded, srcPic.picBuffer, origSubsampled2, origSubsampled4);
+  };
+  WaitCounter meCounter;
+  for (int i = 0; i < numRefs; i++)
+  {
+    if (m_threadPool)
     {
-      int frame = it->first;
-      double strength = it->second;
-      if (receivedPoc % frame == 0)
-      {
-        overallStrength = strength;
-      }
+      m_threadPool->addTask([&, i](int) { estimateMotion(i); }, &meCounter);
+    }
+    else
+    {
+      estimateMotion(i);
     }
-    if ( m_bimEnabled && ( numRefs > 0 ) )
+  }
+  meCounter.wait();
+
+  // filter
+  PelStorage newOrgPic;
+  newOrgPic.create(m_chromaFormatIdc, m_area, 0, m_padding);
+  double overallStrength = -1.0;
+  for (std::map<int, double>::const_iterator it = m_temporalFilterStrengths.begin(); it != m_temporalFilterStrengths.end();
+       ++it)
+  {
+    int frame = it->first;
+    double strength = it->second;
+    if (receivedPoc % frame == 0)
     {
-      const int bimFirstFrame = std::max(currentFilePoc - 2, firstFrame);
-      const int bimLastFrame  = std::min(currentFilePoc + 2, lastFrame);
-      std::vector<double> sumError(m_numCtu * 2, 0);
-      std::vector<int>    blkCount(m_numCtu * 2, 0);
+      overallStrength = strength;
+    }
+  }
+  if ( m_bimEnabled && ( numRefs > 0 ) )
+  {
+    const int bimFirstFrame = std::max(currentFilePoc - 2, firstFrame);
+    const int bimLastFrame  = std::min(currentFilePoc + 2, lastFrame);
+    std::vector<double> sumError(m_numCtu * 2, 0);
+    std::vector<int>    blkCount(m_numCtu * 2, 0);
 
-      int frameIndex = bimFirstFrame - firstFrame;
+    int frameIndex = bimFirstFrame - firstFrame;
 
-      int distFactor[2] = {3,3};
+    int distFactor[2] = {3,3};
 
-      int* qpMap = new int[m_numCtu];
-      for (int poc = bimFirstFrame; poc <= bimLastFrame; poc++)
+    qpMap = new int[m_numCtu];
+    for (int poc = bimFirstFrame; poc <= bimLastFrame; poc++)
+    {
+      if ((poc < 0) || (poc == currentFilePoc) || (frameIndex >= numRefs))
       {
-        if ((poc < 0) || (poc == currentFilePoc) || (frameIndex >= numRefs))
-        {
-          continue; // frame not available or frame that is being filtered
-        }
-        int dist = abs(poc - currentFilePoc) - 1;
-        distFactor[dist]--;
-        TemporalFilterSourcePicInfo &srcPic = srcFrameInfo.at(frameIndex);
-        for (int y = 0; y < srcPic.mvs.h() / 2; y++) // going over in 8x8 block steps
-        {
-          for (int x = 0; x < srcPic.mvs.w() / 2; x++)
-          {
-            int blocksPerRow = (srcPic.mvs.w() / 2 + (m_ctuSize / 8 - 1)) / (m_ctuSize / 8);
-            int ctuX = x / (m_ctuSize / 8);
-            int ctuY = y / (m_ctuSize / 8);
-            int ctuId = ctuY * blocksPerRow + ctuX;
-            sumError[dist * m_numCtu + ctuId] += srcPic.mvs.get(x, y).error;
-            blkCount[dist * m_numCtu + ctuId] += 1;
-          }
-        }
-        frameIndex++;
+        continue; // frame not available or frame that is being filtered
       }
-      double weight = (receivedPoc % 16) ? 0.6 : 1;
-      const double center = 45.0;
-      for (int i = 0; i < m_numCtu; i++)
+      int dist = abs(poc - currentFilePoc) - 1;
+      distFactor[dist]--;
+      TemporalFilterSourcePicInfo &srcPic = srcFrameInfo.at(frameIndex);
+      for (int y = 0; y < srcPic.mvs.h() / 2; y++) // going over in 8x8 block steps
       {
-        int avgErrD1 = (int)((sumError[i] / blkCount[i]) * distFactor[0]);
-        int avgErrD2 = (int)((sumError[i + m_numCtu] / blkCount[i + m_numCtu]) * distFactor[1]);
-        int weightedErr = std::max(avgErrD1, avgErrD2) + abs(avgErrD2 - avgErrD1) * 3;
-        weightedErr = (int)(weightedErr * weight + (1 - weight) * center);
-        if (weightedErr > m_cuTreeThresh[0])
-        {
-          qpMap[i] = 2;
-        }
-        else if (weightedErr > m_cuTreeThresh[1])
-        {
-          qpMap[i] = 1;
-        }
-        else if (weightedErr < m_cuTreeThresh[3])
-        {
-          qpMap[i] = -2;
-        }
-        else if (weightedErr < m_cuTreeThresh[2])
+        for (int x = 0; x < srcPic.mvs.w() / 2; x++)
         {
-          qpMap[i] = -1;
-        }
-        else
-        {
-          qpMap[i] = 0;
+          int blocksPerRow = (srcPic.mvs.w() / 2 + (m_ctuSize / 8 - 1)) / (m_ctuSize / 8);
+          int ctuX = x / (m_ctuSize / 8);
+          int ctuY = y / (m_ctuSize / 8);
+          int ctuId = ctuY * blocksPerRow + ctuX;
+          sumError[dist * m_numCtu + ctuId] += srcPic.mvs.get(x, y).error;
+          blkCount[dist * m_numCtu + ctuId] += 1;
         }
       }
-      m_ctuAdaptedQP->insert({ receivedPoc, qpMap });
+      frameIndex++;
     }
-
-    if ( m_mctfEnabled && ( numRefs > 0 ) )
+    double weight = (receivedPoc % 16) ? 0.6 : 1;
+    const double center = 45.0;
+    for (int i = 0; i < m_numCtu; i++)
     {
-      bilateralFilter(origPadded, srcFrameInfo, newOrgPic, overallStrength);
-
-      // move filtered to orgPic
-      orgPic->copyFrom(newOrgPic);
+      int avgErrD1 = (int)((sumError[i] / blkCount[i]) * distFactor[0]);
+      int avgErrD2 = (int)((sumError[i + m_numCtu] / blkCount[i + m_numCtu]) * distFactor[1]);
+      int weightedErr = std::max(avgErrD1, avgErrD2) + abs(avgErrD2 - avgErrD1) * 3;
+      weightedErr = (int)(weightedErr * weight + (1 - weight) * center);
+      if (weightedErr > m_cuTreeThresh[0])
+      {
+        qpMap[i] = 2;
+      }
+      else if (weightedErr > m_cuTreeThresh[1])
+      {
+        qpMap[i] = 1;
+      }
+      else if (weightedErr < m_cuTreeThresh[3])
+      {
+        qpMap[i] = -2;
+      }
+      else if (weightedErr < m_cuTreeThresh[2])
+      {
+        qpMap[i] = -1;
+      }
+      else
+      {
+        qpMap[i] = 0;
+      }
     }
+  }
 
-    yuvFrames.close();
-    return true;
+  if ( m_mctfEnabled && ( numRefs > 0 ) )
+  {
+    bilateralFilter(origPadded, srcFrameInfo, newOrgPic, overallStrength);
+
+    // move filtered to orgPic
+    orgPic.copyFrom(newOrgPic);
   }
-  return false;
+
+  yuvFrames.close();
+  return true;
 }
 
-// ====================================================================================================================
-// Private member functions
-// ====================================================================================================================
+void EncTemporalFilter::skipFrames(VideoIOYuv &yuvFrames, const int numFrames) const
+{
+  if (m_sourceWidthBeforeScale != 0 && m_sourceHeightBeforeScale != 0)
+  {
+    yuvFrames.skipFrames(numFrames, m_sourceWidthBeforeScale, m_sourceHeightBeforeScale, m_chromaFormatIdc);
+  }
+  else
+  {
+    yuvFrames.skipFrames(numFrames, m_sourceWidth - m_pad[0], m_sourceHeight - m_pad[1], m_chromaFormatIdc);
+  }
+}
+
+bool EncTemporalFilter::readFrame(VideoIOYuv &yuvFrames, PelStorage &pic) const
+{
+  PelStorage dummyPicBufferTO; // Only used temporary in yuvFrames.read
+  int        pad[2] = { m_pad[0], m_pad[1] };
+  bool readOk = false;
+  if (m_sourceWidthBeforeScale != 0 && m_sourceHeightBeforeScale != 0)
+  {
+    Area areaPrescale(0, 0, m_sourceWidthBeforeScale, m_sourceHeightBeforeScale);
+    PelStorage m_orgPicBeforeScale;
+    m_orgPicBeforeScale.create(m_chromaFormatIdc, areaPrescale, 0, m_padding);
+    dummyPicBufferTO.create(m_chromaFormatIdc, areaPrescale, 0, m_padding);
+    readOk = yuvFrames.read(m_orgPicBeforeScale, dummyPicBufferTO, m_inputColourSpaceConvert, pad, m_chromaFormatIdc,
+      m_clipInputVideoToRec709Range);
+    if (readOk)
+    {
+      int w0 = m_sourceWidthBeforeScale;
+      int h0 = m_sourceHeightBeforeScale;
+      int w1 = m_sourceWidth - m_pad[0];
+      int h1 = m_sourceHeight - m_pad[1];
+      int xScale = ((w0 << ScalingRatio::BITS) + (w1 >> 1)) / w1;
+      int yScale = ((h0 << ScalingRatio::BITS) + (h1 >> 1)) / h1;
+      ScalingRatio scalingRatio = { xScale, yScale };
+      Window conformanceWindow1(0, m_pad[0] / SPS::getWinUnitX(m_chromaFormatIdc), 0, m_pad[1] / SPS::getWinUnitY(m_chromaFormatIdc));
+
+      bool downsampling = (m_sourceWidthBeforeScale > m_sourceWidth) || (m_sourceHeightBeforeScale > m_sourceHeight);
+      bool useLumaFilter = downsampling;
+      Picture::rescalePicture(scalingRatio, m_orgPicBeforeScale, Window(), pic, conformanceWindow1,
+        m_chromaFormatIdc, m_internalBitDepth, useLumaFilter, downsampling,
+        m_sourceHorCollocatedChromaFlag != 0, m_sourceVerCollocatedChromaFlag != 0);
+    }
+  }
+  else
+  {
+    dummyPicBufferTO.create(m_chromaFormatIdc, m_area, 0, m_padding);
+    readOk = yuvFrames.read(pic, dummyPicBufferTO, m_inputColourSpaceConvert, pad, m_chromaFormatIdc,
+      m_clipInputVideoToRec709Range);
+  }
+  return readOk;
+}
 
 void EncTemporalFilter::subsampleLuma(const PelStorage &input, PelStorage &output, const int factor) const
 {
@@ -728,12 +858,50 @@ void EncTemporalFilter::bilateralFilter(const PelStorage &orgPic,
 {
   const int numRefs = int(srcFrameInfo.size());
   std::vector<PelStorage> correctedPics(numRefs);
+  WaitCounter counter;
   for (int i = 0; i < numRefs; i++)
   {
     correctedPics[i].create(m_chromaFormatIdc, m_area, 0, m_padding);
-    applyMotion(srcFrameInfo[i].mvs, srcFrameInfo[i].picBuffer, correctedPics[i]);
+    if (m_threadPool)
+    {
+      m_threadPool->addTask([&, i](int) { applyMotion(srcFrameInfo[i].mvs, srcFrameInfo[i].picBuffer, correctedPics[i]); },
+                            &counter);
+    }
+    else
+    {
+      applyMotion(srcFrameInfo[i].mvs, srcFrameInfo[i].picBuffer, correctedPics[i]);
+    }
   }
+  counter.wait();
 
+  if (m_threadPool == nullptr)
+  {
+    bilateralFilterRows(orgPic, srcFrameInfo, correctedPics, newOrgPic, overallStrength, 0, orgPic.Y().height);
+    return;
+  }
+
+  // the bands are aligned to the 8x8 luma blocks, whose noise is estimated and then used by the band's rows only
+  static const int bandHeight = 64;
+  for (int y = 0; y < orgPic.Y().height; y += bandHeight)
+  {
+    const int endY = std::min(y + bandHeight, (int) orgPic.Y().height);
+    m_threadPool->addTask(
+      [&, y, endY](int)
+      { bilateralFilterRows(orgPic, srcFrameInfo, correctedPics, newOrgPic, overallStrength, y, endY); },
+      &counter);
+  }
+  counter.wait();
+}
+
+void EncTemporalFilter::bilateralFilterRows(const PelStorage &orgPic,
+  std::deque<TemporalFilterSourcePicInfo> &srcFrameInfo,
+  const std::vector<PelStorage> &correctedPics,
+  PelStorage &newOrgPic,
+  double overallStrength,
+  const int firstLumaRow,
+  const int endLumaRow) const
+{
+  const int numRefs = int(srcFrameInfo.size());
   const int refStrengthRow = m_futureRefs > 0 ? 0 : 1;
 
   const double lumaSigmaSq = (m_QP - m_sigmaZeroPoint) * (m_QP - m_sigmaZeroPoint) * m_sigmaMultiplier;
@@ -742,11 +910,8 @@ void EncTemporalFilter::bilateralFilter(const PelStorage &orgPic,
   for (int c = 0; c < getNumberValidComponents(m_chromaFormatIdc); c++)
   {
     const ComponentID compID = (ComponentID)c;
-    const int height = orgPic.bufs[c].height;
     const int width  = orgPic.bufs[c].width;
-    const Pel* srcPelRow = orgPic.bufs[c].buf;
     const ptrdiff_t   srcStride             = orgPic.bufs[c].stride;
-    Pel              *dstPelRow             = newOrgPic.bufs[c].buf;
     const ptrdiff_t   dstStride             = newOrgPic.bufs[c].stride;
     const double sigmaSq = isChroma(compID) ? chromaSigmaSq : lumaSigmaSq;
     const double weightScaling = overallStrength * (isChroma(compID) ? m_chromaFactor : 0.4);
@@ -761,8 +926,12 @@ void EncTemporalFilter::bilateralFilter(const PelStorage &orgPic,
     const int csy           = getComponentScaleY(compID, m_chromaFormatIdc);
     const int blockSizeX = lumaBlockSize >> csx;
     const int blockSizeY = lumaBlockSize >> csy;
+    const int firstRow   = firstLumaRow >> csy;
+    const int endRow     = endLumaRow == orgPic.Y().height ? orgPic.bufs[c].height : endLumaRow >> csy;
+    const Pel *srcPelRow = orgPic.bufs[c].buf + firstRow * srcStride;
+    Pel       *dstPelRow = newOrgPic.bufs[c].buf + firstRow * dstStride;
 
-    for (int y = 0; y < height; y++, srcPelRow += srcStride, dstPelRow += dstStride)
+    for (int y = firstRow; y < endRow; y++, srcPelRow += srcStride, dstPelRow += dstStride)
     {
       const Pel *srcPel = srcPelRow;
       Pel *dstPel = dstPelRow;
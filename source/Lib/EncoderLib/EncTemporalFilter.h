@@ -39,9 +39,11 @@
 #define __TEMPORAL_FILTER__
 #include "CommonLib/Unit.h"
 #include "CommonLib/Buffer.h"
+#include "CommonLib/ThreadPool.h"
 #include <sstream>
 #include <map>
 #include <deque>
+#include <memory>
 
 
 //! \ingroup EncoderLib
@@ -96,6 +98,8 @@ public:
   }
 };
 
+class VideoIOYuv;
+
 struct TemporalFilterSourcePicInfo
 {
   TemporalFilterSourcePicInfo() : picBuffer(), mvs(), origOffset(0) { }
@@ -112,7 +116,7 @@ class EncTemporalFilter
 {
 public:
   EncTemporalFilter();
-  ~EncTemporalFilter() {}
+  ~EncTemporalFilter() { setLookaheadPool(nullptr); }
 
   void init(const int frameSkip, const BitDepths &inputBitDepth, const BitDepths &msbExtendedBitDepth,
             const BitDepths &internalBitDepth, const int width, const int height, const int *pad, const bool rec709,
@@ -125,10 +129,30 @@ public:
             std::map<int, int *> *adaptQPmap, const bool bBIMenabled, const int ctuSize);
 
   bool filter(PelStorage *orgPic, int frame);
+  bool isFilteredFrame(const int receivedPoc) const;
+
+  /// starts filtering the frame of the input file in the background, ahead of its coding
+  void filterAhead(const int receivedPoc);
+  /// replaces orgPic by the frame filtered ahead, if it was filtered from the same original, returns false otherwise
+  bool takeFilteredAhead(PelStorage *orgPic, const int receivedPoc);
+
+  /// runs the motion estimation of the references and the filtering of row bands on the given pool (nullptr: none)
+  void setThreadPool(ThreadPool *threadPool) { m_threadPool = threadPool; }
+  /// runs filterAhead() on the given pool (nullptr: none, the pending results are waited for and dropped)
+  void setLookaheadPool(ThreadPool *lookaheadPool);
 
 private:
   static constexpr int BASELINE_BIT_DEPTH = 10;
 
+  struct FilteredAheadPic
+  {
+    WaitCounter done;
+    PelStorage  orgPic;        ///< original as read from the input file
+    PelStorage  filteredPic;
+    bool        isFiltered = false;
+    int        *qpMap      = nullptr;
+  };
+
   // Private static member variables
   static const double m_chromaFactor;
   static const double m_sigmaMultiplier;
@@ -171,8 +195,14 @@ private:
   int m_numCtu;
   int m_ctuSize;
   std::map<int, int*> *m_ctuAdaptedQP;
+  ThreadPool          *m_threadPool;
+  ThreadPool          *m_lookaheadPool;
+  std::map<int, std::unique_ptr<FilteredAheadPic>> m_filteredAhead;   ///< frames filtered ahead, by POC
 
   // Private functions
+  bool filterFrame(PelStorage &orgPic, const int receivedPoc, int *&qpMap) const;
+  void skipFrames(VideoIOYuv &yuvFrames, const int numFrames) const;
+  bool readFrame(VideoIOYuv &yuvFrames, PelStorage &pic) const;
   void subsampleLuma(const PelStorage &input, PelStorage &output, const int factor = 2) const;
   int64_t motionErrorLuma(const PelStorage& orig, const PelStorage& buffer, const int x, const int y, int dx, int dy,
                           const int bs, const int64_t besterror) const;
@@ -181,6 +211,9 @@ private:
   void motionEstimation(Array2D<MotionVector> &mvs, const PelStorage &orgPic, const PelStorage &buffer, const PelStorage &origSubsampled2, const PelStorage &origSubsampled4) const;
 
   void bilateralFilter(const PelStorage &orgPic, std::deque<TemporalFilterSourcePicInfo> &srcFrameInfo, PelStorage &newOrgPic, double overallStrength) const;
+  void bilateralFilterRows(const PelStorage &orgPic, std::deque<TemporalFilterSourcePicInfo> &srcFrameInfo,
+                           const std::vector<PelStorage> &correctedPics, PelStorage &newOrgPic, double overallStrength,
+                           const int firstLumaRow, const int endLumaRow) const;
   void applyMotion(const Array2D<MotionVector> &mvs, const PelStorage &input, PelStorage &output) const;
 }; // END CLASS DEFINITION EncTemporalFilter
 
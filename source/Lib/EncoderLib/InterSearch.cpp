@@ -175,6 +175,8 @@ void InterSearch::destroy()
   }
   m_uniMvListIdx = 0;
   m_uniMvListSize = 0;
+  m_reusedUniMvs.reset();
+  m_isReusedUniMvFilled.reset();
   m_isInitialized = false;
 }
 
@@ -267,9 +269,36 @@ void InterSearch::init(EncCfg *pcEncCfg, TrQuant *pcTrQuant, int searchRange, in
   }
   m_uniMvListIdx = 0;
   m_uniMvListSize = 0;
+  const size_t numReusedUniMvs = MAX_CU_SIZE_IN_PARTS * MAX_CU_SIZE_IN_PARTS * MAX_NUM_SIZES * MAX_NUM_SIZES;
+  m_reusedUniMvs.reset(new RefSetArray<Mv>[numReusedUniMvs]);
+  m_isReusedUniMvFilled.reset(new bool[numReusedUniMvs]);
+  resetReusedUniMvs();
   m_isInitialized = true;
 }
 
+static size_t getReusedUniMvIdx(const Area &area, const PreCalcValues &pcv)
+{
+  unsigned idx1, idx2, idx3, idx4;
+  getAreaIdx(area, pcv, idx1, idx2, idx3, idx4);
+  CHECKD(idx3 >= MAX_NUM_SIZES || idx4 >= MAX_NUM_SIZES, "MAX_NUM_SIZES is too small");
+  return ((idx1 * MAX_CU_SIZE_IN_PARTS + idx2) * MAX_NUM_SIZES + idx3) * MAX_NUM_SIZES + idx4;
+}
+
+void InterSearch::resetReusedUniMvs()
+{
+  std::fill_n(m_isReusedUniMvFilled.get(), MAX_CU_SIZE_IN_PARTS * MAX_CU_SIZE_IN_PARTS * MAX_NUM_SIZES * MAX_NUM_SIZES,
+              false);
+}
+
+void InterSearch::insertReusedUniMvCands(const CompArea &area, const PreCalcValues &pcv)
+{
+  const size_t idx = getReusedUniMvIdx(area, pcv);
+  if (m_isReusedUniMvFilled[idx])
+  {
+    insertUniMvCands(area, m_reusedUniMvs[idx]);
+  }
+}
+
 void InterSearch::resetSavedAffineMotion()
 {
   for ( int i = 0; i < 2; i++ )
@@ -3233,12 +3262,9 @@ void InterSearch::predInterSearch(CodingUnit& cu, Partitioner& partitioner)
       {
         insertUniMvCands(pu.Y(), cMvTemp);
 
-        unsigned idx1, idx2, idx3, idx4;
-        getAreaIdx(cu.Y(), *cu.slice->getPPS()->pcv, idx1, idx2, idx3, idx4);
-        CHECKD(idx3 >= MAX_NUM_SIZES || idx4 >= MAX_NUM_SIZES, "MAX_NUM_SIZES is too small");
-        ::memcpy(&(g_reusedUniMVs[idx1][idx2][idx3][idx4][0][0]), cMvTemp,
-                 sizeof(cMvTemp));
-        g_isReusedUniMVsFilled[idx1][idx2][idx3][idx4] = true;
+        const size_t idx = getReusedUniMvIdx(cu.Y(), *cu.slice->getPPS()->pcv);
+        ::memcpy(&(m_reusedUniMvs[idx][0][0]), cMvTemp, sizeof(cMvTemp));
+        m_isReusedUniMvFilled[idx] = true;
       }
       //  Bi-predictive Motion estimation
       if( ( cs.slice->isInterB() ) && ( PU::isBipredRestriction( pu ) == false )
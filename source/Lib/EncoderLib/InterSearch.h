@@ -52,6 +52,7 @@
 #include "CommonLib/AffineGradientSearch.h"
 #include "CommonLib/IbcHashMap.h"
 #include "CommonLib/Hash.h"
+#include <memory>
 #include <unordered_map>
 #include <vector>
 #include "EncReshape.h"
@@ -139,6 +140,8 @@ private:
   int             m_uniMvListIdx;
   int             m_uniMvListSize;
   int             m_uniMvListMaxSize;
+  std::unique_ptr<RefSetArray<Mv>[]> m_reusedUniMvs;        ///< best uni-prediction MVs per CTU relative CU position and size
+  std::unique_ptr<bool[]>            m_isReusedUniMvFilled;
   Distortion      m_hevcCost;
 #if GDR_ENABLED
   bool            m_hevcCostOk;
@@ -281,6 +284,9 @@ public:
     }
   }
   void resetUniMvList() { m_uniMvListIdx = 0; m_uniMvListSize = 0; }
+  void resetReusedUniMvs();
+  /// adds the uni-prediction MVs found for the same CU area in an earlier partitioning to the MV candidates
+  void insertReusedUniMvCands( const CompArea &area, const PreCalcValues &pcv );
   void insertUniMvCands(CompArea blkArea, RefSetArray<Mv> &cMvTemp)
   {
     BlkUniMvInfo* curMvInfo = m_uniMvList + m_uniMvListIdx;
@@ -364,6 +370,7 @@ public:
   bool isValidBv(PredictionUnit& pu, int xPos, int yPos, int width, int height, int picWidth, int picHeight, int xBv,
                  int yBv, int ctuSize);
   void setClipMvInSubPic(bool flag) { m_clipMvInSubPic = flag; }
+  bool getClipMvInSubPic() const { return m_clipMvInSubPic; }
 protected:
 
   /// sub-function for motion vector refinement used in fractional-pel accuracy
@@ -33,6 +33,7 @@
 
 #include <vector>
 #include <algorithm>
+#include <cstring>
 #include <ostream>
 
 #include "CommonLib/NAL.h"
@@ -87,40 +88,45 @@ void writeNaluContent(std::ostream &out, OutputNALUnit &nalu)
    */
   std::vector<uint8_t> &rbsp = nalu.m_bitstream.getFifo();
 
-  std::vector<uint8_t> outputBuffer;
-  outputBuffer.resize(rbsp.size()*2+1); //there can never be enough emulation_prevention_three_bytes to require this much space
-  std::size_t outputAmount = 0;
-  int         zeroCount    = 0;
-  for (std::vector<uint8_t>::iterator it = rbsp.begin(); it != rbsp.end(); it++)
+  // only the zero byte pairs need to be looked at, the bytes between them are written in runs
+  const uint8_t *const end   = rbsp.data() + rbsp.size();
+  const uint8_t       *write = rbsp.data();
+  const uint8_t       *scan  = rbsp.data();
+
+  while (end - scan >= 3)
   {
-    const uint8_t v=(*it);
-    if (zeroCount==2 && v<=3)
+    const uint8_t *zero = static_cast<const uint8_t *>(memchr(scan, 0x00, end - scan - 2));
+    if (zero == nullptr)
     {
-      outputBuffer[outputAmount++]=emulation_prevention_three_byte;
-      zeroCount=0;
+      break;
     }
-
-    if (v==0)
+    if (zero[1] != 0x00)
     {
-      zeroCount++;
+      scan = zero + 2;
+      continue;
     }
-    else
+    if (zero[2] > 0x03)
     {
-      zeroCount=0;
+      scan = zero + 3;
+      continue;
     }
-    outputBuffer[outputAmount++]=v;
+
+    out.write(reinterpret_cast<const char *>(write), zero + 2 - write);
+    out.put(emulation_prevention_three_byte);
+    write = zero + 2;
+    scan  = write;
   }
+  out.write(reinterpret_cast<const char *>(write), end - write);
 
   /* 7.4.1.1
    * ... when the last byte of the RBSP data is equal to 0x00 (which can
    * only occur when the RBSP ends in a cabac_zero_word), a final byte equal
    * to 0x03 is appended to the end of the data.
    */
-  if (zeroCount>0)
+  if (!rbsp.empty() && rbsp.back() == 0x00)
   {
-    outputBuffer[outputAmount++]=emulation_prevention_three_byte;
+    out.put(emulation_prevention_three_byte);
   }
-  out.write(reinterpret_cast<const char*>(&(*outputBuffer.begin())), outputAmount);
 }
 
 void writeNaluWithHeader(std::ostream &out, OutputNALUnit &nalu)
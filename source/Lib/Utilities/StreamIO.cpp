@@ -0,0 +1,85 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2025, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     StreamIO.cpp
+    \brief    standard input/output streams as files
+*/
+
+#include <cstdio>
+#include <iostream>
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+#include "CommonLib/CommonDef.h"
+#include "StreamIO.h"
+
+// descriptor of the standard output, after the messages were moved over to the standard error (-1: not moved)
+static int g_stdOutDataFd = -1;
+static bool g_stdOutDataUsed = false;
+
+void redirectMessagesToStdErr()
+{
+  if (g_stdOutDataFd >= 0)
+  {
+    return;
+  }
+#if defined(_WIN32)
+  EXIT("The standard output cannot be used as a file on this platform");
+#else
+  fflush(stdout);
+  std::cout.flush();
+  g_stdOutDataFd = dup(STDOUT_FILENO);
+  CHECK(g_stdOutDataFd < 0 || dup2(STDERR_FILENO, STDOUT_FILENO) < 0, "Cannot redirect the standard output");
+#endif
+}
+
+std::string getStreamFileName(const std::string &fileName, bool writeMode)
+{
+  if (!isStdStreamFileName(fileName))
+  {
+    return fileName;
+  }
+#if defined(_WIN32)
+  EXIT("The standard input and output cannot be used as files on this platform");
+#else
+  if (!writeMode)
+  {
+    return "/dev/stdin";
+  }
+  CHECK(g_stdOutDataUsed, "Only one output can be written to the standard output");
+  g_stdOutDataUsed = true;
+  redirectMessagesToStdErr();
+  return "/dev/fd/" + std::to_string(g_stdOutDataFd);
+#endif
+}
@@ -37,9 +37,14 @@
 #include <fstream>
 #include <iostream>
 #include <memory.h>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #include "CommonLib/Rom.h"
 #include "VideoIOYuv.h"
+#include "StreamIO.h"
 #include "CommonLib/Unit.h"
 
 namespace Y4M
@@ -170,7 +175,7 @@ void VideoIOYuv::open(const std::string& fileName, bool writeMode, const BitDept
 
   if (writeMode)
   {
-    m_fileStream.open(fileName.c_str(), std::ios::binary | std::ios::out);
+    m_fileStream.open(getStreamFileName(fileName, true).c_str(), std::ios::binary | std::ios::out);
 
     if (m_fileStream.fail())
     {
@@ -198,7 +203,7 @@ void VideoIOYuv::open(const std::string& fileName, bool writeMode, const BitDept
                            dummyLocType);
       }
     }
-    m_fileStream.open(fileName.c_str(), std::ios::binary | std::ios::in);
+    m_fileStream.open(getStreamFileName(fileName, false).c_str(), std::ios::binary | std::ios::in);
 
     if (m_fileStream.fail())
     {
@@ -209,6 +214,11 @@ void VideoIOYuv::open(const std::string& fileName, bool writeMode, const BitDept
     {
       m_fileStream.seekg(m_inY4mFileHeaderLength, std::ios::cur);
     }
+
+    if (mapInputFile(getStreamFileName(fileName, false)))
+    {
+      m_mappedFilePos = m_inY4mFileHeaderLength;
+    }
   }
 }
 
@@ -326,11 +336,128 @@ void VideoIOYuv::writeY4mFileHeader()
   m_fileStream.write(header.c_str(), header.length());
 }
 
-void VideoIOYuv::close() { m_fileStream.close(); }
+void VideoIOYuv::close()
+{
+  unmapInputFile();
+  m_fileStream.close();
+}
+
+bool VideoIOYuv::isEof() { return m_mappedFile != nullptr ? m_mappedFileEof : m_fileStream.eof(); }
+
+bool VideoIOYuv::isFail() { return m_mappedFile != nullptr ? m_mappedFileEof : m_fileStream.fail(); }
+
+/**
+ * Map a regular input file into memory, so that the frames are converted
+ * straight from the mapped pages and skipped without any reading.
+ *
+ * @return true if the file was mapped, false if it is read through the file stream
+ */
+bool VideoIOYuv::mapInputFile(const std::string &fileName)
+{
+  unmapInputFile();
+#if !defined(_WIN32)
+  const int fd = ::open(fileName.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  // pipes and devices cannot be mapped, as well as empty files
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size <= 0)
+  {
+    ::close(fd);
+    return false;
+  }
+
+  const size_t fileSize = size_t(fileStat.st_size);
+  void        *mapped   = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED)
+  {
+    return false;
+  }
+  madvise(mapped, fileSize, MADV_SEQUENTIAL);
+
+  m_mappedFile     = static_cast<const uint8_t *>(mapped);
+  m_mappedFileSize = fileSize;
+  m_mappedFilePos  = 0;
+  m_mappedFileEof  = false;
+  return true;
+#else
+  return false;
+#endif
+}
+
+void VideoIOYuv::unmapInputFile()
+{
+#if !defined(_WIN32)
+  if (m_mappedFile != nullptr)
+  {
+    munmap(const_cast<uint8_t *>(m_mappedFile), m_mappedFileSize);
+  }
+#endif
+  m_mappedFile     = nullptr;
+  m_mappedFileSize = 0;
+  m_mappedFilePos  = 0;
+  m_mappedFileEof  = false;
+}
+
+/**
+ * Read size bytes of the input.
+ *
+ * @param data  set to the bytes read, which are the mapped bytes or the ones read into buf
+ * @param buf   buffer of size bytes for reading through the file stream
+ * @return true for success, false at the end of the input
+ */
+bool VideoIOYuv::readInput(const uint8_t *&data, uint8_t *buf, const size_t size)
+{
+  if (m_mappedFile != nullptr)
+  {
+    if (size > m_mappedFileSize - m_mappedFilePos)
+    {
+      m_mappedFilePos = m_mappedFileSize;
+      m_mappedFileEof = true;
+      return false;
+    }
+    data = m_mappedFile + m_mappedFilePos;
+    m_mappedFilePos += size;
+    return true;
+  }
+
+  m_fileStream.read(reinterpret_cast<char *>(buf), size);
+  data = buf;
+  return !m_fileStream.eof() && !m_fileStream.fail();
+}
+
+/**
+ * Skip size bytes of the input.
+ *
+ * @return true for success, false at the end of the input
+ */
+bool VideoIOYuv::skipInput(const size_t size)
+{
+  if (m_mappedFile != nullptr)
+  {
+    const uint8_t *data = nullptr;
+    return readInput(data, nullptr, size);
+  }
 
-bool VideoIOYuv::isEof() { return m_fileStream.eof(); }
+  if (!!m_fileStream.seekg(size, std::ios::cur))
+  {
+    return true;
+  }
+  m_fileStream.clear();
 
-bool VideoIOYuv::isFail() { return m_fileStream.fail(); }
+  // a pipe cannot seek, the input is consumed instead
+  char   buf[512];
+  size_t numSkipped = 0;
+  while (numSkipped < size && m_fileStream.read(buf, std::min(sizeof(buf), size - numSkipped)))
+  {
+    numSkipped += size_t(m_fileStream.gcount());
+  }
+  return !m_fileStream.eof() && !m_fileStream.fail();
+}
 
 /**
  * Skip numFrames in input.
@@ -371,6 +498,13 @@ void VideoIOYuv::skipFrames(uint32_t numFrames, uint32_t width, uint32_t height,
 
   const std::streamoff offset = frameSize * numFrames;
 
+  if (m_mappedFile != nullptr)
+  {
+    // as with seeking, skipping beyond the end of the file shows on the next read only
+    m_mappedFilePos = std::min(m_mappedFilePos + size_t(offset), m_mappedFileSize);
+    return;
+  }
+
   /* attempt to seek */
   if (!!m_fileStream.seekg(offset, std::ios::cur))
   {
@@ -389,12 +523,11 @@ void VideoIOYuv::skipFrames(uint32_t numFrames, uint32_t width, uint32_t height,
 }
 
 /**
- * Read width*height pixels from fd into dst, optionally
+ * Read width*height pixels from the input into dst, optionally
  * padding the left and right edges by edge-extension.  Input may be
  * either 8bit or 16bit little-endian lsb-aligned words.
  *
  * @param dst          destination image plane
- * @param fd           input file stream
  * @param is16bit      true if input file carries > 8bit data, false otherwise.
  * @param stride444    distance between vertically adjacent pixels of dst.
  * @param width444     width of active area in dst.
@@ -407,9 +540,9 @@ void VideoIOYuv::skipFrames(uint32_t numFrames, uint32_t width, uint32_t height,
  * @param fileBitDepth component bit depth in file
  * @return true for success, false in case of error
  */
-static bool readPlane(Pel *dst, std::istream &fd, bool is16bit, ptrdiff_t stride444, uint32_t width444,
-                      uint32_t height444, uint32_t pad_x444, uint32_t pad_y444, const ComponentID compID,
-                      const ChromaFormat destFormat, const ChromaFormat fileFormat, const uint32_t fileBitDepth)
+bool VideoIOYuv::readPlane(Pel *dst, bool is16bit, ptrdiff_t stride444, uint32_t width444, uint32_t height444,
+                           uint32_t pad_x444, uint32_t pad_y444, const ComponentID compID,
+                           const ChromaFormat destFormat, const ChromaFormat fileFormat, const uint32_t fileBitDepth)
 {
   const uint32_t csxFile = getComponentScaleX(compID, fileFormat);
   const uint32_t csyFile = getComponentScaleY(compID, fileFormat);
@@ -429,8 +562,8 @@ static bool readPlane(Pel *dst, std::istream &fd, bool is16bit, ptrdiff_t stride
   const uint32_t fullHeightDest = heightDest + padDestY;
 
   const uint32_t       strideFile = (width444 * (is16bit ? 2 : 1)) >> csxFile;
-  std::vector<uint8_t> bufVec(strideFile);
-  uint8_t *buf=&(bufVec[0]);
+  std::vector<uint8_t> bufVec(m_mappedFile != nullptr ? 0 : strideFile);
+  const uint8_t       *buf = nullptr;
 
   Pel*            pDstPad              = dst + strideDest * heightDest;
   Pel  *pDstBuf              = dst;
@@ -454,8 +587,7 @@ static bool readPlane(Pel *dst, std::istream &fd, bool is16bit, ptrdiff_t stride
     if (isChromaEnabled(fileFormat))
     {
       const uint32_t heightFile = height444 >> csyFile;
-      fd.seekg(heightFile * strideFile, std::ios::cur);
-      if (fd.eof() || fd.fail() )
+      if (!skipInput(size_t(heightFile) * strideFile))
       {
         return false;
       }
@@ -470,8 +602,7 @@ static bool readPlane(Pel *dst, std::istream &fd, bool is16bit, ptrdiff_t stride
       if ((y444 & maskFileY) == 0)
       {
         // read a new line
-        fd.read(reinterpret_cast<char*>(buf), strideFile);
-        if (fd.eof() || fd.fail() )
+        if (!readInput(buf, bufVec.data(), strideFile))
         {
           return false;
         }
@@ -1045,13 +1176,13 @@ bool VideoIOYuv::read(PelUnitBuf& pic, PelUnitBuf& picOrg, const InputColourSpac
 
   if (m_inY4mFileHeaderLength)
   {
-    char frameHeader[Y4M::FRAME_HEADER_LENGTH + 1];
-    m_fileStream.read(frameHeader, Y4M::FRAME_HEADER_LENGTH);
-    if (m_fileStream.eof() || m_fileStream.fail())
+    uint8_t        frameHeaderBuf[Y4M::FRAME_HEADER_LENGTH];
+    const uint8_t *frameHeader = nullptr;
+    if (!readInput(frameHeader, frameHeaderBuf, Y4M::FRAME_HEADER_LENGTH))
     {
       return false;
     }
-    CHECK(strncmp(frameHeader, Y4M::FRAME_HEADER, Y4M::FRAME_HEADER_LENGTH), "Wrong Y4M frame header!");
+    CHECK(memcmp(frameHeader, Y4M::FRAME_HEADER, Y4M::FRAME_HEADER_LENGTH), "Wrong Y4M frame header!");
   }
 
   const PelBuf areaBufY = picOrg.get(COMPONENT_Y);
@@ -1086,7 +1217,7 @@ bool VideoIOYuv::read(PelUnitBuf& pic, PelUnitBuf& picOrg, const InputColourSpac
 #if EXTENSION_360_VIDEO
     const ptrdiff_t stride444 = picOrg.get(compID).stride;
 #endif
-    if (!readPlane(dst, m_fileStream, is16bit, stride444, width444, height444, padH444, padV444, compID,
+    if (!readPlane(dst, is16bit, stride444, width444, height444, padH444, padV444, compID,
                    picOrg.chromaFormat, format, m_fileBitdepth[chType]))
     {
       return false;
@@ -70,9 +70,22 @@ private:
   Chroma420LocType m_outLocType            = Chroma420LocType::UNSPECIFIED;
   bool         m_outY4m                = false;
 
+  const uint8_t *m_mappedFile     = nullptr;   // memory mapped input file (nullptr: read through the file stream)
+  size_t         m_mappedFileSize = 0;
+  size_t         m_mappedFilePos  = 0;         // read position in the mapped input file
+  bool           m_mappedFileEof  = false;     // a read went beyond the end of the mapped input file
+
+  bool mapInputFile(const std::string& fileName);
+  void unmapInputFile();
+  bool readInput(const uint8_t*& data, uint8_t* buf, const size_t size);
+  bool skipInput(const size_t size);
+  bool readPlane(Pel* dst, bool is16bit, ptrdiff_t stride444, uint32_t width444, uint32_t height444,
+                 uint32_t pad_x444, uint32_t pad_y444, const ComponentID compID, const ChromaFormat destFormat,
+                 const ChromaFormat fileFormat, const uint32_t fileBitDepth);
+
 public:
   VideoIOYuv()           {}
-  virtual ~VideoIOYuv()  {}
+  virtual ~VideoIOYuv()  { unmapInputFile(); }
 
   void parseY4mFileHeader(const std::string& fileName, int& width, int& height, Fraction& frameRate, int& bitDepth,
                           ChromaFormat& chromaFormat, Chroma420LocType& locType);